@@ -1,11 +1,13 @@
-#include <xc.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "buggy.h"
 #include "motors.h"
 #include "flags.h"
-
-#define _XTAL_FREQ 64000000 // for __delay_ms
+#include "hal.h"
+#include "clock.h"
+#include "calibration.h"
+#include "checkpoint.h"
+#include "telemetry.h"
 
 #define MAP_SIZE 6 // side length of map
 #define NUM_DIR 8
@@ -14,6 +16,15 @@
 #define START_Y 0
 #define START_DIR DIR_N
 
+// checkpoint entries, one per primitive, replayed to rebuild the map and pose after a reset
+#define ENTRY_SEARCH 0x00 // | card << 3 | cells moved: at the wall, map updated
+#define ENTRY_RECENTRED 0x80 // back at the centre of the cell
+#define ENTRY_TURN 0x88 // | 45deg turns, 3-bit two's complement
+#define ENTRY_CARD_DONE 0x10 // | ENTRY_TURN: the turn that finishes a card's manoeuvre
+#define ENTRY_ADVANCE 0xA0 // one cell forward
+#define ENTRY_REVERSE 0xA1 // one cell back
+#define MAX_CELLS_MOVED 0x07
+
 typedef enum {
     DIR_N, DIR_NE, DIR_E, DIR_SE, DIR_S, DIR_SW, DIR_W, DIR_NW,
     // 0,1    1,1    1,0    1,-1   0,-1   -1,-1   -1,0    -1,1
@@ -37,18 +48,116 @@ struct {
     Direction dir;
 } map;
 
-inline bool isDirOrthogonal(Direction dir) {
+static inline bool isDirOrthogonal(Direction dir) {
     return dir == DIR_N || dir == DIR_E || dir == DIR_S || dir == DIR_W;
 }
 
-inline bool isOutOfBounds(int8_t x, int8_t y) {
+static inline bool isOutOfBounds(int8_t x, int8_t y) {
     return x < 0 || x >= MAP_SIZE || y < 0 || y >= MAP_SIZE;
 }
 
+static bool is_replaying = false; // rebuilding the map from the checkpoint, nothing moves
+
+static inline void logPose(void) {
+    #ifdef __TELEMETRY
+        const Cell *cell = &map.cells[map.y][map.x];
+        telemetry_pose(map.x, map.y, map.dir, cell->walls, cell->steps);
+    #endif
+}
+
+static inline void checkpoint(uint8_t entry) {
+    if (!is_replaying) checkpoint_append(entry);
+}
+
+// -------------------- START MOVES --------------------
+
+// Moves are queued ahead with motors_queue() and the map updated as planned.
+// Each move's checkpoint entry, and the pose it leaves the buggy in, wait here
+// until the executor has finished it, so the journal still only records what
+// the buggy has done.
+
+#define MAX_PENDING 16 // power of two, more than the queue and the command running
+
+typedef struct {
+    bool is_logged; // has a checkpoint entry
+    uint8_t entry;
+    int8_t x; // pose once done
+    int8_t y;
+    Direction dir;
+} PendingMove;
+
+static struct {
+    PendingMove moves[MAX_PENDING];
+    uint8_t head;
+    uint8_t tail;
+    uint16_t finished; // motors_finished() when the move at tail was queued, plus those done since
+} pending;
+
+static void finishMoves(void) {
+    uint16_t finished = motors_finished();
+    while (pending.tail != pending.head && pending.finished != finished) {
+        const PendingMove *move = &pending.moves[pending.tail];
+        pending.tail = (pending.tail + 1) & (MAX_PENDING - 1);
+        ++pending.finished;
+        #ifdef __TELEMETRY
+            const Cell *cell = &map.cells[move->y][move->x];
+            telemetry_pose(move->x, move->y, move->dir, cell->walls, cell->steps);
+        #endif
+        if (move->is_logged) checkpoint_append(move->entry);
+    }
+}
+
+static bool isMoveRunning(void) {
+    return motors_poll() && motors_finished() == pending.finished;
+}
+
+static void waitForMove(void) {
+    clock_waitWhile(isMoveRunning);
+    finishMoves();
+}
+
+static void waitForMoves(void) {
+    while (pending.tail != pending.head) waitForMove();
+}
+
+// after the map has been updated for the move
+static void queueMove(MotionType type, int8_t arg, bool is_logged, uint8_t entry) {
+    if (pending.tail == pending.head) pending.finished = motors_finished();
+    while (((pending.head + 1) & (MAX_PENDING - 1)) == pending.tail) waitForMove();
+    pending.moves[pending.head] = (PendingMove) {is_logged, entry, map.x, map.y, map.dir};
+    pending.head = (pending.head + 1) & (MAX_PENDING - 1);
+    while (!motors_queue(type, arg)) waitForMove();
+}
+
+// -------------------- END MOVES --------------------
+
+// ends_card: this turn finishes the manoeuvre for a card
+static void turn(int8_t num_45, bool ends_card) {
+    map.dir = (Direction) ((map.dir + num_45 + NUM_DIR) % NUM_DIR);
+    if (is_replaying) {
+        logPose();
+        return;
+    }
+    queueMove(MOTION_TURN, num_45, true, ENTRY_TURN | (ends_card ? ENTRY_CARD_DONE : 0) | (uint8_t) (num_45 & 0x07));
+}
+
+static void advance(int8_t cells) { // one cell forward or back
+    Direction dir = cells > 0 ? map.dir : DIR_OPPOSITE[map.dir];
+    map.x += DIR_DX[dir];
+    map.y += DIR_DY[dir];
+    if (is_replaying) {
+        logPose();
+        return;
+    }
+    queueMove(MOTION_ADVANCE, cells, true, cells > 0 ? ENTRY_ADVANCE : ENTRY_REVERSE);
+}
+
 void updateMap(Direction dir, uint8_t steps) {
     Cell *cur_cell = &(map.cells[map.y][map.x]);
     for (uint8_t k = 0; k < steps; ++k) {
-        map.x += DIR_DX[dir]; // NOTE: overflow is ignored, should not happen if setup correctly (bold assumption)
+        // a search that overran the map, e.g. resumed off the start cell, stops at its edge
+        if (isOutOfBounds(map.x + DIR_DX[dir], map.y + DIR_DY[dir])) break;
+        map.x += DIR_DX[dir];
         map.y += DIR_DY[dir];
         Cell *new_cell = &(map.cells[map.y][map.x]);
         
@@ -78,85 +187,74 @@ void updateMap(Direction dir, uint8_t steps) {
         cur_cell->walls = 0b1111; // indicate diagonal wall
         cur_cell->is_forward_diagonal = (dir == DIR_SE || dir == DIR_NW) ? true : false;
     }
+    logPose();
 }
 
 // if after a turn, then try to realign backwards (is_forward = 0), if after advance, try to align forwards
 void realign(bool is_forward) {
+    if (is_replaying) return;
     Direction dir = is_forward ? map.dir : DIR_OPPOSITE[map.dir];
     // if there's a wall marked in dir direction
     if (isDirOrthogonal(dir) && ((map.cells[map.y][map.x].walls >> (dir / 2)) & 0b1)) {
-        motors_realign(is_forward);
+        queueMove(MOTION_REALIGN, is_forward, false, 0);
     } else { // on diagonal path
         // TODO
     }
 }
 
+// the whole way home is planned from the map and queued, as far ahead as the
+// queue holds
 void returnHome(void) {
-    Cell *cur_cell = &(map.cells[map.y][map.x]);
-    while (cur_cell->steps != 0) {
+    while (map.cells[map.y][map.x].steps != 0) {
 //        while (PORTFbits.RF2) {}
-//        __delay_ms(1000);
+//        clock_sleep_ms(1000);
         // turn to start direction
-        int8_t turn_num = cur_cell->dir - map.dir;
+        int8_t turn_num = map.cells[map.y][map.x].dir - map.dir;
         if (turn_num != 0) { // if turn is needed
             if (turn_num > 4) turn_num -= NUM_DIR;
             else if (turn_num < -4) turn_num += NUM_DIR;
-            motors_turn(turn_num);
-            map.dir = cur_cell->dir;
+            turn(turn_num, false);
         }
         
         // realign after rotation
         realign(false);
         
         // advance once and update position
-        motors_advance(1);
-        map.x += DIR_DX[cur_cell->dir];
-        map.y += DIR_DY[cur_cell->dir];
-        cur_cell = &(map.cells[map.y][map.x]);
+        advance(1);
         
         // realign after advance
         realign(true);
     }
+    waitForMoves();
 }
 
 // returns whether or not all is completed
 bool processCard(Card card) {
     switch (card) {
         case RED: // turn right
-            motors_turn(2);
-            map.dir = (map.dir + 2) % NUM_DIR;
+            turn(2, true);
             break;
         case GREEN: // turn left
-            motors_turn(-2);
-            map.dir = (map.dir + 6) % NUM_DIR;
+            turn(-2, true);
             break;
         case DBLUE: // u-turn
-            motors_turn(4);
-            map.dir = DIR_OPPOSITE[map.dir];
+            turn(4, true);
             break;
         case YELLOW: // reverse and turn right
-            motors_advance(-1);
-            map.x += DIR_DX[DIR_OPPOSITE[map.dir]];
-            map.y -= DIR_DY[DIR_OPPOSITE[map.dir]];
+            advance(-1);
             realign(false); // try to realign after reversing
-            motors_turn(2);
-            map.dir = (map.dir + 2) % NUM_DIR;
+            turn(2, true);
             break;
         case PINK: // reverse and turn left
-            motors_advance(-1);
-            map.x += DIR_DX[DIR_OPPOSITE[map.dir]];
-            map.y -= DIR_DY[DIR_OPPOSITE[map.dir]];
+            advance(-1);
             realign(false); // try to realign after reversing
-            motors_turn(-2);
-            map.dir = (map.dir + 6) % NUM_DIR;
+            turn(-2, true);
             break;
         case ORANGE: // turn 135 degrees right
-            motors_turn(3);
-            map.dir = (map.dir + 3) % NUM_DIR;
+            turn(3, true);
             break;
         case LBLUE:
-            motors_turn(-3);
-            map.dir = (map.dir + 5) % NUM_DIR;
+            turn(-3, true);
             break;
         case WHITE: // fall through
         case BLACK: // fall through
@@ -166,10 +264,43 @@ bool processCard(Card card) {
             break;
     }
     realign(false); // try to realign after direction change
+    waitForMoves(); // the next search reads the wall as it goes
     return false;
 }
 
+// Rebuild the map and pose from an unfinished mission's checkpoints, then
+// pick it up. Between cards, or short of the cell centre, the next search
+// squares up on the wall ahead. Part way through a manoeuvre or the way home
+// it goes home directly; a reset in the middle of a turn leaves the heading
+// off by however far it got. Returns whether it went home.
+static bool resume(const uint8_t *entries, uint8_t num_entries) {
+    bool is_pending = false; // card read but its manoeuvre not finished
+    bool is_recentred = false;
+    is_replaying = true;
+    for (uint8_t i = 0; i < num_entries; ++i) {
+        uint8_t entry = entries[i];
+        if (entry < ENTRY_RECENTRED) {
+            updateMap(map.dir, entry & MAX_CELLS_MOVED);
+            is_pending = true;
+            is_recentred = false;
+        } else if (entry == ENTRY_RECENTRED) {
+            is_recentred = true;
+        } else if ((entry & ~(ENTRY_CARD_DONE | 0x07)) == ENTRY_TURN) {
+            turn((int8_t) ((entry & 0x07) ^ 0x04) - 4, false); // sign-extend
+            if (entry & ENTRY_CARD_DONE) is_pending = false;
+        } else if (entry == ENTRY_ADVANCE || entry == ENTRY_REVERSE) {
+            advance(entry == ENTRY_ADVANCE ? 1 : -1);
+        }
+    }
+    is_replaying = false;
+    if (!is_pending || !is_recentred) return false;
+    returnHome();
+    return true;
+}
+
 void buggy_init(void) {
+    calibration_load(); // before the modules configure themselves from the tunables
+    clock_init(); // needed by the other modules for delays
     colourClick_init();
     motors_init();
 }
@@ -185,13 +316,25 @@ void buggy_navigate(void) {
     map.y = START_Y;
     map.dir = START_DIR;
     map.cells[map.y][map.x].steps = 0; // starting cell
+    pending.head = pending.tail; // whatever was queued before a reset is gone
+    #ifdef __TELEMETRY
+        telemetry_start();
+    #endif
 
-    bool finished = false;
+    // carry on with a mission a reset cut short
+    uint8_t entries[CHECKPOINT_MAX_ENTRIES];
+    uint8_t num_entries = checkpoint_open(entries);
+    bool finished = num_entries > 0 && resume(entries, num_entries);
+    
+    // each checkpoint is one EEPROM write that finishes during the next primitive
     while (!finished) {
         uint8_t cells_moved;
         Card card = motors_search(&cells_moved); // advance till wall; TODO handle diagonal distance
+        if (cells_moved > MAX_CELLS_MOVED) cells_moved = MAX_CELLS_MOVED; // the map is smaller than that
         updateMap(map.dir, cells_moved); // update internal map for cells covered
-        motors_recentre(); // return to centre; TODO handle diagonal case
+        checkpoint(ENTRY_SEARCH | (uint8_t) (card << 3) | cells_moved);
+        queueMove(MOTION_RECENTRE, 0, true, ENTRY_RECENTRED); // return to centre while the card's moves are planned; TODO handle diagonal case
         finished = processCard(card);
     }
+    checkpoint_close();
 }
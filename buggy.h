@@ -1,8 +1,11 @@
 #ifndef BUGGY_H
 #define	BUGGY_H
 
+#include <stdbool.h>
+#include "colourClick.h"
+
 void buggy_init(void);
 void buggy_navigate(void);
+bool processCard(Card card);
 
 #endif	/* BUGGY_H */
-
@@ -1,14 +1,12 @@
-#include <xc.h>
 #include "buttons.h"
+#include "hal.h"
 
-#define RF2 !PORTFbits.RF2
-#define RF3 !PORTFbits.RF3
+#define RF2 !hal_gpio_read(HAL_RF2_BUTTON)
+#define RF3 !hal_gpio_read(HAL_RF3_BUTTON)
 
 void buttons_init(void) {
-    TRISFbits.TRISF2 = 1; // input
-    ANSELFbits.ANSELF2 = 0; // digital
-    TRISFbits.TRISF3 = 1; // input
-    ANSELFbits.ANSELF3 = 0; // digital
+    hal_gpio_setInput(HAL_RF2_BUTTON); // digital input
+    hal_gpio_setInput(HAL_RF3_BUTTON); // digital input
 }
 
 ButtonsState buttons_readInput(void) {
@@ -16,4 +14,8 @@ ButtonsState buttons_readInput(void) {
         if (RF2) return RF2_DOWN;
         if (RF3) return RF3_DOWN;
     }
-}
\ No newline at end of file
+}
+
+void buttons_waitForRelease(void) {
+    while (RF2 || RF3) {}
+}
@@ -6,7 +6,8 @@ typedef enum {
 } ButtonsState;
 
 void buttons_init(void);
-ButtonsState buttons_readInput(void);
+ButtonsState buttons_readInput(void); // waits for a press
+void buttons_waitForRelease(void);
 
 #endif	/* BUTTONS_H */
 
@@ -0,0 +1,112 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "calibration.h"
+#include "colourClick.h"
+#include "hal.h"
+#include "crc16.h"
+
+#define MAGIC 0xCA1B
+#define HEADER_SIZE 4 // magic, version, payload length
+#define CRC_SIZE 2
+
+// motors.c
+extern int8_t left_fast_power;
+extern int8_t right_fast_power;
+extern int8_t left_slow_power;
+extern int8_t right_slow_power;
+extern int8_t turn_power;
+extern uint16_t forward_fast_duration;
+extern uint16_t forward_duration;
+extern uint16_t backward_duration;
+extern uint16_t left_turn_duration;
+extern uint16_t right_turn_duration;
+extern uint16_t recenter_duration;
+
+// colourClick.c
+extern uint16_t rgb_scaler[];
+extern uint16_t clear_threshold;
+extern uint16_t white_threshold;
+extern uint16_t CARD_H[];
+extern uint16_t CARD_S[];
+
+typedef struct {
+    void *value;
+    uint8_t size;
+} Field;
+
+// payload, in order; stored in the PIC's (little-endian) byte order
+static const Field FIELDS[] = {
+    {&left_fast_power, sizeof(int8_t)},
+    {&right_fast_power, sizeof(int8_t)},
+    {&left_slow_power, sizeof(int8_t)},
+    {&right_slow_power, sizeof(int8_t)},
+    {&turn_power, sizeof(int8_t)},
+    {&forward_fast_duration, sizeof(uint16_t)},
+    {&forward_duration, sizeof(uint16_t)},
+    {&backward_duration, sizeof(uint16_t)},
+    {&left_turn_duration, sizeof(uint16_t)},
+    {&right_turn_duration, sizeof(uint16_t)},
+    {&recenter_duration, sizeof(uint16_t)},
+    {rgb_scaler, 3 * sizeof(uint16_t)},
+    {&clear_threshold, sizeof(uint16_t)},
+    {&white_threshold, sizeof(uint16_t)},
+    {CARD_H, NUM_CARDS * sizeof(uint16_t)},
+    {CARD_S, NUM_CARDS * sizeof(uint16_t)},
+};
+#define NUM_FIELDS (sizeof(FIELDS) / sizeof(FIELDS[0]))
+
+static uint8_t payloadSize(void) {
+    uint8_t size = 0;
+    for (uint8_t i = 0; i < NUM_FIELDS; ++i) size += FIELDS[i].size;
+    return size;
+}
+
+static void writeByte(uint16_t address, uint8_t value) {
+    if (hal_eeprom_read(address) != value) hal_eeprom_write(address, value); // spares the cell and ~4ms
+}
+
+unsigned calibration_size(void) {
+    return HEADER_SIZE + payloadSize() + CRC_SIZE;
+}
+
+bool calibration_load(void) {
+    uint16_t address = CALIBRATION_ADDRESS;
+    uint8_t header[HEADER_SIZE];
+    uint16_t crc = CRC16_INIT;
+    for (uint8_t i = 0; i < HEADER_SIZE; ++i) {
+        header[i] = hal_eeprom_read(address++);
+        crc = crc16_update(crc, header[i]);
+    }
+    if ((header[0] | (uint16_t) (header[1] << 8)) != MAGIC || header[2] != CALIBRATION_VERSION || header[3] != payloadSize()) return false;
+    
+    // check the whole record before touching any value
+    for (uint8_t i = 0; i < header[3]; ++i) crc = crc16_update(crc, hal_eeprom_read(address++));
+    uint16_t stored = hal_eeprom_read(address) | (uint16_t) (hal_eeprom_read(address + 1) << 8);
+    if (crc != stored) return false;
+    
+    address = CALIBRATION_ADDRESS + HEADER_SIZE;
+    for (uint8_t i = 0; i < NUM_FIELDS; ++i) {
+        uint8_t *bytes = FIELDS[i].value;
+        for (uint8_t j = 0; j < FIELDS[i].size; ++j) bytes[j] = hal_eeprom_read(address++);
+    }
+    return true;
+}
+
+void calibration_save(void) {
+    const uint8_t header[HEADER_SIZE] = {MAGIC & 0xff, MAGIC >> 8, CALIBRATION_VERSION, payloadSize()};
+    uint16_t address = CALIBRATION_ADDRESS;
+    uint16_t crc = CRC16_INIT;
+    for (uint8_t i = 0; i < HEADER_SIZE; ++i) {
+        crc = crc16_update(crc, header[i]);
+        writeByte(address++, header[i]);
+    }
+    for (uint8_t i = 0; i < NUM_FIELDS; ++i) {
+        const uint8_t *bytes = FIELDS[i].value;
+        for (uint8_t j = 0; j < FIELDS[i].size; ++j) {
+            crc = crc16_update(crc, bytes[j]);
+            writeByte(address++, bytes[j]);
+        }
+    }
+    writeByte(address, crc & 0xff); // written last: a reset part way through leaves a record that fails its CRC
+    writeByte(address + 1, crc >> 8);
+}
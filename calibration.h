@@ -0,0 +1,19 @@
+#ifndef CALIBRATION_H
+#define	CALIBRATION_H
+
+#include <stdbool.h>
+
+// The calibrated motor and colour tunables, kept in data EEPROM as one
+// record: magic, version, payload length, payload, CRC16. buggy_init() loads
+// it so a calibrated buggy boots ready; a missing, corrupt or older record
+// leaves the compiled-in defaults. Bump CALIBRATION_VERSION whenever the
+// payload changes.
+
+#define CALIBRATION_ADDRESS 0x000 // EEPROM offset of the record
+#define CALIBRATION_VERSION 1
+
+bool calibration_load(void); // applies the stored record, returns whether there was a valid one
+void calibration_save(void); // stores the current values, rewriting only the bytes that changed
+unsigned calibration_size(void); // bytes the record takes in EEPROM
+
+#endif	/* CALIBRATION_H */
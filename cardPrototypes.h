@@ -0,0 +1,19 @@
+// Card prototypes and white/black thresholds for colourClick.c. Hand-tuned;
+// host/card_train refits them from labelled readings and rewrites this file.
+// Regenerate cardTable.c (make -C host card_table) after replacing it.
+// The thresholds are on LED-on minus LED-off counts, as with __AMBIENT_FRAME:
+// white and black both lose the LED-off C at the wall (below clear_threshold),
+// so WHITE_THRESHOLD is the hand-tuned 30000 less half of 300. The ambient adds
+// under one calibrated unit to each channel, so RANGE_THRESHOLD is unchanged.
+
+#ifndef CARD_PROTOTYPES_H
+#define CARD_PROTOTYPES_H
+
+// RED, GREEN, DBLUE, YELLOW, PINK, ORANGE, LBLUE
+#define CARD_H_PROTOTYPES {349, 147, 213,  13, 351, 352, 186} // hue, degrees
+#define CARD_S_PROTOTYPES { 56,  21,  31,  38,  27,  46,  11} // saturation, percent
+
+#define RANGE_THRESHOLD 8
+#define WHITE_THRESHOLD 29850
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef CARD_TABLE_H
+#define	CARD_TABLE_H
+
+// Card lookup for colourClick_lookup(). Calibrated RGB is indexed by its
+// darkest channel, the other two channels' offsets above it (which set the
+// hue) and the darkest value itself (which with the offsets sets saturation).
+// Offsets go through CARD_TABLE_BIN, whose bin 0 is exactly the offsets below
+// range_threshold, so the white/black decision is baked in without error.
+// Each entry is the card colourClick_classify() gives most often in its cell,
+// packed two per byte.
+//
+// cardTable.c is generated by host/card_table from CARD_H/CARD_S and
+// range_threshold; regenerate it whenever those change.
+
+#include <stdint.h>
+#include "colourClick.h"
+
+#define CARD_TABLE_OFFSET_BITS 5 // bins for each of the two offsets
+#define CARD_TABLE_MIN_BITS 4 // darkest channel, top bits
+#define CARD_TABLE_ENTRIES (3UL << (2 * CARD_TABLE_OFFSET_BITS + CARD_TABLE_MIN_BITS))
+#define CARD_TABLE_BYTES (CARD_TABLE_ENTRIES / 2) // 4 bit entries
+
+#define CARD_TABLE_ACHROMATIC BLACK // white or black, decided on the clear channel
+
+extern const uint8_t CARD_TABLE_BIN[256]; // offset -> bin
+extern const uint8_t CARD_TABLE[CARD_TABLE_BYTES]; // const: kept in program memory by XC8
+
+// the generator indexes with its own bins, the firmware with CARD_TABLE_BIN
+static inline uint16_t cardTable_index(const uint8_t *bin, const uint8_t *rgb) {
+    uint8_t darkest = 0;
+    if (rgb[1] < rgb[darkest]) darkest = 1;
+    if (rgb[2] < rgb[darkest]) darkest = 2;
+    uint8_t m = rgb[darkest];
+    uint8_t first = darkest == 0 ? 1 : 0; // the other two channels, in RGB order
+    uint8_t second = darkest == 2 ? 1 : 2;
+    return (uint16_t) ((uint16_t) darkest << (2 * CARD_TABLE_OFFSET_BITS + CARD_TABLE_MIN_BITS)
+            | (uint16_t) bin[rgb[first] - m] << (CARD_TABLE_OFFSET_BITS + CARD_TABLE_MIN_BITS)
+            | (uint16_t) bin[rgb[second] - m] << CARD_TABLE_MIN_BITS
+            | m >> (8 - CARD_TABLE_MIN_BITS));
+}
+
+#endif	/* CARD_TABLE_H */
@@ -0,0 +1,71 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "checkpoint.h"
+#include "hal.h"
+
+static uint16_t head; // log offset of the next entry
+
+static inline uint16_t next(uint16_t offset) {
+    return offset + 1 == CHECKPOINT_SIZE ? 0 : offset + 1;
+}
+
+static inline uint16_t previous(uint16_t offset) {
+    return offset == 0 ? CHECKPOINT_SIZE - 1 : offset - 1;
+}
+
+static inline uint8_t readAt(uint16_t offset) {
+    return hal_eeprom_read(CHECKPOINT_ADDRESS + offset);
+}
+
+static inline void erase(uint16_t offset) {
+    if (readAt(offset) != CHECKPOINT_ERASED) hal_eeprom_write(CHECKPOINT_ADDRESS + offset, CHECKPOINT_ERASED);
+}
+
+uint8_t checkpoint_open(uint8_t *entries) {
+    // written bytes are one circular run ending at the head, or none at all
+    head = 0;
+    uint8_t last = readAt(CHECKPOINT_SIZE - 1);
+    for (uint16_t i = 0; i < CHECKPOINT_SIZE; ++i) {
+        uint8_t byte = readAt(i);
+        if (last != CHECKPOINT_ERASED && byte == CHECKPOINT_ERASED) {
+            head = i;
+            break;
+        }
+        last = byte;
+    }
+    
+    // the open mission runs back from the head to the previous CHECKPOINT_END
+    uint16_t start = head;
+    uint16_t count = 0;
+    while (count < CHECKPOINT_SIZE) {
+        uint8_t byte = readAt(previous(start));
+        if (byte == CHECKPOINT_ERASED || byte == CHECKPOINT_END) break;
+        start = previous(start);
+        ++count;
+    }
+    if (count > CHECKPOINT_MAX_ENTRIES) { // too long to replay, abandon it
+        checkpoint_close();
+        return 0;
+    }
+    for (uint8_t i = 0; i < count; ++i) {
+        entries[i] = readAt(start);
+        start = next(start);
+    }
+    return (uint8_t) count;
+}
+
+void checkpoint_append(uint8_t entry) {
+    uint16_t after = next(head);
+    erase(after); // first, so a reset in between leaves the head where it was
+    hal_eeprom_write(CHECKPOINT_ADDRESS + head, entry);
+    head = after;
+}
+
+void checkpoint_close(void) {
+    checkpoint_append(CHECKPOINT_END);
+    uint16_t offset = next(head); // the head itself is already erased
+    for (uint8_t i = 1; i < CHECKPOINT_MAX_ENTRIES; ++i) {
+        erase(offset);
+        offset = next(offset);
+    }
+}
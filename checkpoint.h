@@ -0,0 +1,26 @@
+#ifndef CHECKPOINT_H
+#define	CHECKPOINT_H
+
+#include <stdint.h>
+#include "hal.h"
+
+// Mission journal in data EEPROM, so a reset mid-mine can pick up where it
+// left off. Entries are single bytes appended to a circular log after the
+// calibration record; a finished mission is closed with CHECKPOINT_END and
+// the next one starts right after it, so every byte of the log wears at
+// the same rate. The erased bytes ahead of the newest entry mark the head.
+// Each append is one background EEPROM write while there is erased space
+// ahead, which closing a mission makes sure of.
+
+#define CHECKPOINT_ADDRESS 0x080 // room for the calibration record before it
+#define CHECKPOINT_SIZE (HAL_EEPROM_SIZE - CHECKPOINT_ADDRESS)
+#define CHECKPOINT_MAX_ENTRIES 64 // longest mission that can be resumed, also erased ahead on closing
+
+#define CHECKPOINT_ERASED 0xFF // never a valid entry
+#define CHECKPOINT_END 0xFE // closes a mission
+
+uint8_t checkpoint_open(uint8_t *entries); // finds the head, copies out an unfinished mission's entries and returns how many (0 if none)
+void checkpoint_append(uint8_t entry); // anything but CHECKPOINT_ERASED and CHECKPOINT_END
+void checkpoint_close(void); // the mission is over, nothing to resume
+
+#endif	/* CHECKPOINT_H */
@@ -0,0 +1,55 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "clock.h"
+#include "hal.h"
+
+static ClockStats stats = {0};
+static bool is_moving = false;
+static uint32_t segment_start_ms = 0; // start of the current moving/waiting segment
+
+// close the current moving/waiting segment at the current time
+static void accountSegment(void) {
+    uint32_t now = hal_clock_ms();
+    if (is_moving) stats.moving_ms += now - segment_start_ms;
+    else stats.waiting_ms += now - segment_start_ms;
+    segment_start_ms = now;
+}
+
+void clock_init(void) {
+    hal_clock_init(); // 1kHz tick
+    is_moving = false;
+    clock_resetStats();
+}
+
+uint32_t clock_now_ms(void) {
+    return hal_clock_ms();
+}
+
+void clock_sleep_ms(uint16_t ms) {
+    stats.sleeping_ms += ms;
+    ++stats.num_sleeps;
+    hal_delay_ms(ms);
+}
+
+void clock_waitWhile(bool (*is_busy)(void)) {
+    uint32_t start = hal_clock_ms();
+    ++stats.num_sleeps;
+    while (is_busy()) hal_waitForInterrupt();
+    stats.sleeping_ms += hal_clock_ms() - start;
+}
+
+void clock_setMoving(bool moving) {
+    if (moving == is_moving) return;
+    accountSegment();
+    is_moving = moving;
+}
+
+const ClockStats *clock_getStats(void) {
+    accountSegment();
+    return &stats;
+}
+
+void clock_resetStats(void) {
+    stats = (ClockStats) {0};
+    segment_start_ms = hal_clock_ms();
+}
@@ -0,0 +1,26 @@
+#ifndef CLOCK_H
+#define	CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// All waiting goes through clock_sleep_ms(). On target the clock is the TMR0
+// 1kHz tick; on the host it is the virtual clock of the Linux HAL backend, so
+// simulations skip idle time instantly.
+
+typedef struct {
+    uint32_t moving_ms; // time with either motor powered
+    uint32_t waiting_ms; // time with both motors stopped
+    uint32_t sleeping_ms; // time spent inside clock_sleep_ms()
+    uint16_t num_sleeps;
+} ClockStats;
+
+void clock_init(void);
+uint32_t clock_now_ms(void);
+void clock_sleep_ms(uint16_t ms);
+void clock_waitWhile(bool (*is_busy)(void)); // sleeps until an interrupt-driven job is done
+void clock_setMoving(bool is_moving); // called by motors_setPower() to attribute time
+const ClockStats *clock_getStats(void);
+void clock_resetStats(void);
+
+#endif	/* CLOCK_H */
@@ -1,32 +1,25 @@
-#include <xc.h>
 #include <stdint.h>
-#include <stdio.h>
 #include "colourClick.h"
+#include "cardTable.h"
+#include "cardPrototypes.h"
 #include "i2c.h"
-#include "timer.h"
+#include "clock.h"
 #include "serial.h"
 #include "buttons.h"
 #include "flags.h"
+#include "hal.h"
+#include "calibration.h"
+#include "telemetry.h"
 
-#define _XTAL_FREQ 64000000 // for __delay_ms
-
-// RGB LED pins
-#ifdef __ONBOARD
-    #define R_PIN LATAbits.LATA0
-    #define G_PIN LATDbits.LATD0
-    #define B_PIN LATCbits.LATC2
-#else
-    #define R_PIN LATGbits.LATG1
-    #define G_PIN LATAbits.LATA4
-    #define B_PIN LATFbits.LATF7
-#endif
+// RGB LED pins (__ONBOARD selects the clicker board LED in hal_xc8.c)
+#define R_PIN HAL_CARD_R
+#define G_PIN HAL_CARD_G
+#define B_PIN HAL_CARD_B
 
-#define INT_PIN PORTBbits.RB1
+#define INT_PIN HAL_COLOUR_INT
 
 // i2c parameters
 #define ADDR 0x52 // colour click i2c address
-#define WRITE 0x00 // write to colour click
-#define READ 0x01 // read from colour click
 
 // colour click registers
 #define R_ENABLE 0x00
@@ -40,7 +33,24 @@
 #define GDATA 0x18 // green data low byte
 #define BDATA 0x1A // blue data low byte
 
-#define READ_DELAY 200
+#define R_WTIME 0x03
+#define R_CONFIG 0x0D
+#define R_STATUS 0x13
+
+#define ENABLE_AEN 0x02 // RGBC enable
+#define ENABLE_WEN 0x08 // wait enable
+#define CONFIG_WLONG 0x02 // wait steps 12x longer
+#define STATUS_AVALID 0x01 // an integration has completed since AEN was set
+#define CONTROL_AGAIN 0x03 // gain select: 1x, 4x, 16x, 60x
+
+#define CALIBRATION_SAMPLES 4 // reads averaged per presented card
+
+#define STEP_US 2400 // one ATIME/WTIME step, also the start-up time after AEN
+
+// shadow of the writable registers, 0x00..0x0F
+#define NUM_SHADOW 0x10
+#define WRITABLE 0b1011000011111011 // CONTROL, CONFIG, APERS, thresholds, WTIME, ATIME, ENABLE; the rest is reserved
+#define MERGE_GAP 2 // clean registers worth rewriting to save a transaction's address and command bytes
 
 #ifndef __DEBUG_MODE
 typedef struct {
@@ -55,11 +65,12 @@ struct {
     uint8_t g;
     uint8_t b;
 } led = {0};
+static bool is_led_on = false; // white, from colourClick_onLED()
 
-// pink 352, 46
-#define NUM_CARDS CLEAR - 2 // a bit cryptic but CLEAR is the number of cards in the Card enum, -2 for excluding black and white
-const uint16_t CARD_H[NUM_CARDS] = {349, 147, 213, 13, 351, 352, 186}; // hues of card colours, except black and white
-const uint16_t CARD_S[NUM_CARDS] = { 56,  21,  31, 38,  27,  46,  11}; // saturations of card colours, except black and white
+uint16_t CARD_H[NUM_CARDS] = CARD_H_PROTOTYPES; // hues of card colours, except black and white
+uint16_t CARD_S[NUM_CARDS] = CARD_S_PROTOTYPES; // saturations of card colours, except black and white
+
+static const char *const CARD_NAMES[CLEAR] = {"RED", "GREEN", "DBLUE", "YELLOW", "PINK", "ORANGE", "LBLUE", "WHITE", "BLACK"};
 
 #ifdef __CARD_LED // RGB colours for each coloured card, for debugging colour read
 const uint8_t CARD_R[NUM_CARDS] = {255,   0,   0, 255, 255, 255,   0};
@@ -68,48 +79,79 @@ const uint8_t CARD_B[NUM_CARDS] = {  0,   0, 255,   0, 128,   0, 255};
 #endif
 
 uint16_t clear_threshold = 300; // (LED off) above this is CLEAR, below this is wall
-const uint8_t range_threshold = 8; // (LED on) if range of RGB values is less than threshold, only consider white/black - no calibration needed
-uint16_t white_threshold = 30000; // (LED on) if C channel is larger than threshold, then white, otherwise black
+uint8_t range_threshold = RANGE_THRESHOLD; // (LED on) if range of RGB values is less than threshold, only consider white/black - no calibration needed
+uint16_t white_threshold = WHITE_THRESHOLD; // (LED on) if C channel is larger than threshold, then white, otherwise black
+
+uint16_t rgb_scaler[] = {16384, 21742, 31080}; // Q2.14 white balance: 1, 1.327, 1.897
 
-float rgb_scaler[] = {1, 1.327, 1.897};
+#ifdef __CARD_TABLE
+static const uint16_t LINKED_H[NUM_CARDS] = CARD_H_PROTOTYPES; // the prototypes cardTable.c was generated from
+static const uint16_t LINKED_S[NUM_CARDS] = CARD_S_PROTOTYPES;
+#endif
+
+typedef struct {
+    uint8_t atime; // integration time, (256 - atime) * 2.4ms
+    uint8_t control; // gain in CONTROL_AGAIN
+} ProfileConfig;
+
+// clear_threshold and white_threshold are calibrated in COLOUR_PRECISE
+const ProfileConfig PROFILES[] = {
+    [COLOUR_SEARCH] = {0xF6, 0x13}, // 24ms, 60x: 2.3x the counts of PRECISE, a wall interrupt 2 ~26ms cycles after the shroud darkens
+    [COLOUR_PRECISE] = {0xC0, 0x11}, // 154ms, 4x: colour read
+};
+static const uint8_t GAIN[4] = {1, 4, 16, 60};
+
+static struct {
+    ColourProfile active;
+    uint16_t wall_threshold; // clear_threshold in the active profile
+} profile;
+
+static struct {
+    bool clear; // nothing in front of the sensor on the LED-off frame
+    uint8_t frame; // frames started
+    uint32_t start_ms; // of the latest frame
+    uint16_t ambient[4]; // LED-off C, R, G, B
+} card_read;
+
+static ColourStats stats;
+
+static struct {
+    uint8_t shadow[NUM_SHADOW]; // what the sensor holds once dirty registers are flushed
+    uint16_t dirty; // bit per register
+} registers;
 
 // -------------------- START LED FUNCTIONS --------------------
 
 void initLED(void) {
     // initialise RGB LED pins
-    #ifdef __ONBOARD
-        TRISAbits.TRISA0 = 0; // red output
-        TRISDbits.TRISD0 = 0; // green output
-        TRISCbits.TRISC2 = 0; // blue output
-    #else
-        TRISGbits.TRISG1 = 0; // red output
-        TRISAbits.TRISA4 = 0; // green output
-        TRISFbits.TRISF7 = 0; // blue output
-    #endif
-    TRISBbits.TRISB1 = 1; // input
-    ANSELBbits.ANSELB1 = 0; // digital input
+    hal_gpio_setOutput(R_PIN); // red output
+    hal_gpio_setOutput(G_PIN); // green output
+    hal_gpio_setOutput(B_PIN); // blue output
+    hal_gpio_setInput(INT_PIN); // digital input
     #ifdef __CARD_LED
-        TMR2_init(); // initial TMR2 for RGB LED PWM
+        hal_ledTimer_init(); // initial TMR2 for RGB LED PWM
     #endif
 }
 
 void colourClick_onLED(void) {
+    is_led_on = true;
     #ifdef __CARD_LED
         colourClick_setLED(255, 255, 255);
     #else
-        R_PIN = 1;
-        B_PIN = 1;
-        G_PIN = 1;
+        hal_gpio_write(R_PIN, 1);
+        hal_gpio_write(B_PIN, 1);
+        hal_gpio_write(G_PIN, 1);
     #endif
 }
 
 void colourClick_offLED(void) {
+    is_led_on = false;
     #ifdef __CARD_LED
         colourClick_setLED(0, 0, 0);
     #else
-        R_PIN = 0;
-        B_PIN = 0;
-        G_PIN = 0;
+        hal_gpio_write(R_PIN, 0);
+        hal_gpio_write(B_PIN, 0);
+        hal_gpio_write(G_PIN, 0);
     #endif
 }
 
@@ -124,9 +166,9 @@ void colourClick_setLED(uint8_t r, uint8_t g, uint8_t b) {
 #ifdef __CARD_LED
 void colourClick_interruptLED(void) {
     static uint8_t counter = 0;
-    R_PIN = counter < led.r ? 1 : 0;
-    G_PIN = counter < led.g ? 1 : 0;
-    B_PIN = counter < led.b ? 1 : 0;
+    hal_gpio_write(R_PIN, counter < led.r);
+    hal_gpio_write(G_PIN, counter < led.g);
+    hal_gpio_write(B_PIN, counter < led.b);
     ++counter;
 }
 #endif
@@ -134,296 +176,588 @@ void colourClick_interruptLED(void) {
 // -------------------- END LED FUNCTIONS --------------------
 // -------------------- START I2C FUNCTIONS --------------------
 
-inline void setAddress(uint8_t address, bool auto_increment) {
-    I2C2_sendByte(0x80 | (uint8_t) (auto_increment << 5) | address); // command: register address
+static inline uint8_t command(uint8_t address, bool auto_increment) {
+    return 0x80 | (uint8_t) (auto_increment << 5) | address; // command: register address
+}
+
+// write consecutive registers from address in one transaction
+static void writeBytesTo(uint8_t address, const uint8_t *values, uint8_t num_values) {
+    I2C2Transaction txn = {.address = ADDR, .command = command(address, true), .write = values, .num_write = num_values};
+    I2C2_transfer(&txn);
+}
+
+// read consecutive registers from address in one transaction, zeros if it fails
+static void readBytesFrom(uint8_t address, uint8_t *values, uint8_t num_values) {
+    for (uint8_t i = 0; i < num_values; ++i) values[i] = 0;
+    I2C2Transaction txn = {.address = ADDR, .command = command(address, true), .read = values, .num_read = num_values};
+    I2C2_transfer(&txn);
+}
+
+// write the dirty registers, merging runs separated by a few clean writable
+// ones when rewriting those is cheaper than another transaction
+static void flushRegisters(void) {
+    uint8_t address = 0;
+    while (registers.dirty != 0) {
+        while (!(registers.dirty & (1U << address))) ++address; // start of the next run
+        uint8_t end = address; // last dirty register in the run
+        for (uint8_t next = address + 1; next < NUM_SHADOW && (WRITABLE & (1U << next)); ++next) {
+            if (registers.dirty & (1U << next)) end = next;
+            else if (next - end > MERGE_GAP) break;
+        }
+        writeBytesTo(address, registers.shadow + address, end - address + 1);
+        for (; address <= end; ++address) registers.dirty &= (uint16_t) ~(1U << address);
+    }
+}
+
+// only marks the register dirty if the value changes
+static void setRegister(uint8_t address, uint8_t value) {
+    if (registers.shadow[address] == value) return;
+    registers.shadow[address] = value;
+    registers.dirty |= (uint16_t) (1U << address);
 }
 
-// write to colour click at a given address
+// write to colour click at a given address, skipped if it already holds value
 void writeByteTo(uint8_t address, uint8_t value) {
-    I2C2_start();
-    I2C2_sendByte(ADDR | WRITE); // writing to colour click
-    setAddress(address, false); // set address without auto-increment
-    I2C2_sendByte(value); // write to address
-    I2C2_stop();
+    setRegister(address, value);
+    flushRegisters();
 }
 
 void setInterruptLowThreshold(uint16_t c) {
-    writeByteTo(AILTL, c & 0xff);
-    writeByteTo(AILTL + 1, (c >> 8) & 0xff);
-    writeByteTo(AIHTL, 0xff);
-    writeByteTo(AIHTL + 1, 0xff);
+    setRegister(AILTL, c & 0xff);
+    setRegister(AILTL + 1, (c >> 8) & 0xff);
+    setRegister(AIHTL, 0xff);
+    setRegister(AIHTL + 1, 0xff);
+    flushRegisters();
+}
+
+#ifdef __DEBUG_MODE
+// compare the shadow with the device, true if every writable register matches
+bool colourClick_verifyRegisters(void) {
+    uint8_t device[NUM_SHADOW];
+    readBytesFrom(R_ENABLE, device, NUM_SHADOW);
+    for (uint8_t i = 0; i < NUM_SHADOW; ++i) {
+        if ((WRITABLE & (1U << i)) && device[i] != registers.shadow[i]) return false;
+    }
+    return true;
 }
+#endif
 
 // initialise colour click with i2c
 void colourClick_init(void) {
     I2C2_init(); // initialise i2c Master
     initLED(); // initialise RGB LED
+    readBytesFrom(R_ENABLE, registers.shadow, NUM_SHADOW); // start from what the sensor holds, it may not have been reset
+    registers.dirty = 0;
     writeByteTo(R_ENABLE, 0x01); // enable colour click
-    __delay_ms(3); // wait for start up before further configuration
-    writeByteTo(R_ENABLE, 0b00010011);
+    clock_sleep_ms(3); // wait for start up before further configuration
+    setRegister(R_ENABLE, 0b00010011);
     //                         || |+------ PON: power on
     //                         || +------- AEN: RGBC enable
     //                         |+--------- WEN: wait enable
     //                         +---------- AIEN: RGBC interrupt enable
-    writeByteTo(R_ATIME, 0xC0); // set integration time to 0xC0: 154ms; 0x00: 700ms
-    writeByteTo(R_CONTROL, 0x11); // 0x10: 16x gain; 0x11: 60x gain
-    writeByteTo(APERS, 0b0010); // 2 clear channel consecutive values out of range for interrupt trigger
-    setInterruptLowThreshold(clear_threshold);
+    setRegister(APERS, 0b0010); // 2 clear channel consecutive values out of range for interrupt trigger
+    colourClick_setProfile(COLOUR_PRECISE); // flushes the lot
+}
+
+// clear channel count c in COLOUR_PRECISE, scaled by integration time and gain to the active profile
+static uint16_t toActiveProfile(uint16_t c) {
+    const ProfileConfig *from = &PROFILES[COLOUR_PRECISE], *to = &PROFILES[profile.active];
+    uint32_t scaled = (uint32_t) c * (uint16_t) (256 - to->atime) * GAIN[to->control & CONTROL_AGAIN];
+    scaled /= (uint16_t) (256 - from->atime) * GAIN[from->control & CONTROL_AGAIN];
+    return scaled > UINT16_MAX ? UINT16_MAX : (uint16_t) scaled;
+}
+
+// switch integration time, gain and the wall interrupt threshold; only registers that change are written
+void colourClick_setProfile(ColourProfile id) {
+    profile.active = id;
+    profile.wall_threshold = toActiveProfile(clear_threshold);
+    setRegister(R_ATIME, PROFILES[id].atime);
+    setRegister(R_CONTROL, PROFILES[id].control);
+    setInterruptLowThreshold(profile.wall_threshold); // flushes
+}
+
+ColourProfile colourClick_getProfile(void) {
+    return profile.active;
+}
+
+// integration and wait times from the configured ATIME/WTIME
+uint16_t colourClick_integrationMs(void) {
+    return (uint16_t) (((uint32_t) (256 - registers.shadow[R_ATIME]) * STEP_US + 999) / 1000);
+}
+
+uint16_t colourClick_cycleMs(void) {
+    uint32_t wait_us = 0;
+    if (registers.shadow[R_ENABLE] & ENABLE_WEN) {
+        wait_us = (uint32_t) (256 - registers.shadow[R_WTIME]) * STEP_US;
+        if (registers.shadow[R_CONFIG] & CONFIG_WLONG) wait_us *= 12;
+    }
+    return colourClick_integrationMs() + (uint16_t) ((wait_us + 999) / 1000);
+}
+
+static uint8_t readStatus(void) {
+    uint8_t status;
+    readBytesFrom(R_STATUS, &status, 1);
+    return status;
+}
+
+// restart RGBC so the next cycle runs entirely under the current LED and
+// profile; clears AVALID and the interrupt persistence count
+static void restartIntegration(void) {
+    uint8_t enable = registers.shadow[R_ENABLE];
+    writeByteTo(R_ENABLE, enable & (uint8_t) ~ENABLE_AEN);
+    writeByteTo(R_ENABLE, enable);
+}
+
+// start-up plus integration of the active profile, from restartIntegration() to AVALID
+uint16_t colourClick_sampleMs(void) {
+    return (uint16_t) ((STEP_US + 999) / 1000) + colourClick_integrationMs();
+}
+
+// Sleep out whatever is left of the sample started at start_ms, then poll
+// AVALID for the sensor's oscillator tolerance. Falls through after a full
+// extra cycle if it never comes.
+static void awaitSample(uint32_t start_ms) {
+    uint32_t elapsed = clock_now_ms() - start_ms;
+    if (elapsed < colourClick_sampleMs()) clock_sleep_ms((uint16_t) (colourClick_sampleMs() - elapsed));
+    uint16_t timeout = colourClick_cycleMs();
+    while (!(readStatus() & STATUS_AVALID) && timeout-- > 0) {
+        clock_sleep_ms(1);
+    }
+}
+
+static void waitForSample(void) {
+    restartIntegration();
+    awaitSample(clock_now_ms());
 }
 
 bool readInterrupt(void) {
-    return INT_PIN; // note interrupt is active LOW
+    return hal_gpio_read(INT_PIN); // note interrupt is active LOW
 }
 
 void clearInterrupt(void) {
-    I2C2_start();
-    I2C2_sendByte(ADDR | WRITE); // writing to colour click
-    I2C2_sendByte(0x80 | (uint8_t) (0b11 << 5) | 0b00110); // command: special function: clear interrupt
-    I2C2_stop();
+    I2C2Transaction txn = {.address = ADDR, .command = 0x80 | (uint8_t) (0b11 << 5) | 0b00110}; // command: special function: clear interrupt
+    I2C2_transfer(&txn);
+}
+
+// read consecutive 16-bit channels starting at address, in one transaction
+static void readWords(uint8_t address, uint16_t *words, uint8_t num_words) {
+    uint8_t bytes[8];
+    readBytesFrom(address, bytes, (uint8_t) (2 * num_words));
+    for (uint8_t i = 0; i < num_words; ++i) {
+        words[i] = bytes[2 * i] | (uint16_t) (bytes[2 * i + 1] << 8); // low byte first
+    }
 }
 
 uint16_t readC(void) {
-    I2C2_start();
-    I2C2_sendByte(ADDR | WRITE); // writing to colour click
-    setAddress(CDATA, false); // set address to clear low byte with auto-increment
-    I2C2_repeatStart(); // start another transmission without stopping
-    I2C2_sendByte(ADDR | READ); // reading from colour click
-    uint16_t value = I2C2_readByte(true); // read low byte with acknowledge
-    return value | (uint16_t) (I2C2_readByte(false) << 8); // read high byte without acknowledge
+    uint16_t value;
+    readWords(CDATA, &value, 1);
+    return value;
 }
 
 const uint16_t *readRGB(void) {
     static uint16_t RGB[3] = {0};
-    
-    I2C2_start();
-    I2C2_sendByte(ADDR | WRITE); // writing to colour click
-    setAddress(RDATA, true); // set address to clear low byte with auto-increment
-    I2C2_repeatStart(); // start another transmission without stopping
-    I2C2_sendByte(ADDR | READ); // reading from colour click
-    
-    // read RG
-    uint16_t value;
-    for (uint8_t i = 0; i < 2; ++i) {
-        value = I2C2_readByte(true); // read low byte with acknowledge
-        RGB[i] = value | (uint16_t) (I2C2_readByte(true) << 8); // read high byte with acknowledge
-    }
-    // read B separately to avoid final acknowledge bit
-    value = I2C2_readByte(true); // read low byte with acknowledge
-    RGB[2] = value | (uint16_t) (I2C2_readByte(false) << 8); // read high byte without acknowledge
-    
+    readWords(RDATA, RGB, 3);
     return RGB;
 }
 
+// C, R, G, B in one burst; the sensor latches all four from the same integration cycle
+const uint16_t *readRGBC(void) {
+    static uint16_t CRGB[4] = {0};
+    readWords(CDATA, CRGB, 4);
+    #ifdef __TELEMETRY
+        telemetry_rgbc(CRGB, is_led_on);
+    #endif
+    return CRGB;
+}
+
 // -------------------- END I2C FUNCTIONS --------------------
 // -------------------- START COLOUR FUNCTIONS --------------------
 
-inline int16_t ab(int16_t a) {
+static inline int16_t ab(int16_t a) {
     return a < 0 ? -a : a;
 }
 
-inline float max(float a, float b) {
+static inline uint8_t max(uint8_t a, uint8_t b) {
     return a > b ? a : b;
 }
 
-inline float min(float a, float b) {
+static inline uint8_t min(uint8_t a, uint8_t b) {
     return a < b ? a : b;
 }
 
+// integer HSL: h in degrees 0..359, s and l in percent, all truncated like the
+// float conversion they replace (no soft-float on the PIC18)
 const HSLColour *rgb2hsl(const uint8_t R, const uint8_t G, const uint8_t B) {
     static HSLColour HSL = {0};
     
-    float r = (float) R / 255;
-    float g = (float) G / 255;
-    float b = (float) B / 255;
-    
-    float M = max(r, max(g, b));
-    float m = min(r, min(g, b));
-    float c = M - m;
-    
-    float h, s, l;
+    uint8_t M = max(R, max(G, B));
+    uint8_t m = min(R, min(G, B));
+    uint8_t c = M - m;
+    uint16_t sum = (uint16_t) M + m; // 2 * lightness, out of 510
     
-    if (c < 1e-10) {
-        h = 0;
+    if (c == 0) {
+        HSL.h = 0;
+    } else if (M == R) {
+        if (G >= B) HSL.h = (uint16_t) (60 * (G - B) / c);
+        else HSL.h = (uint16_t) ((360 * (uint32_t) c - 60 * (uint16_t) (B - G)) / c);
+    } else if (M == G) {
+        HSL.h = (uint16_t) ((120 * (uint32_t) c + 60 * (int16_t) (B - R)) / c);
     } else {
-        float segment = 0;
-        float shift = 0;
-        if (M == r) {
-            segment = (g - b) / c;
-            if (segment < 0)
-                shift = 6;
-        } else if (M == g) {
-            segment = (b - r) / c;
-            shift = 2;
-        } else {
-            segment = (r - g) / c;
-            shift = 4;
-        }
-        h = segment + shift;
+        HSL.h = (uint16_t) ((240 * (uint32_t) c + 60 * (int16_t) (R - G)) / c);
     }
     
-    l = (M + m) / 2;
-    if (l == 0 || l == 1) {
-        s = 0;
+    if (sum == 0 || sum == 510) {
+        HSL.s = 0;
     } else {
-        float temp = (2 * l - 1);
-        s = c / (1 - (temp < 0 ? -temp : temp));
+        uint16_t range = sum < 255 ? sum : 510 - sum; // 255 * (1 - |2l - 1|)
+        HSL.s = (uint8_t) ((100 * (uint16_t) c) / range);
     }
-        
-    HSL.h = (uint16_t) (h * 60);
-    HSL.s = (uint8_t) (s * 100);
-    HSL.l = (uint8_t) (l * 100);
+    HSL.l = (uint8_t) ((100 * (uint32_t) sum) / 510);
     return &HSL;
 }
 
-const uint8_t *readCalibratedRGB(void) {
-    static uint8_t rgb[3] = {0};
-    const uint16_t *raw_rgb = readRGB();
+// white-balance raw counts into 0..255
+void colourClick_calibrate(const uint16_t *raw_rgb, uint8_t *rgb) {
     for (uint8_t i = 0; i < 3; ++i) {
-        uint16_t value = (uint16_t) ((float) raw_rgb[i] * rgb_scaler[i] / 256);
+        uint32_t value = ((uint32_t) raw_rgb[i] * rgb_scaler[i]) >> 22; // Q2.14 scaler, then / 256
         rgb[i] = value < 256 ? (uint8_t) value : 255;
     }
+}
+
+const uint8_t *readCalibratedRGB(void) {
+    static uint8_t rgb[3] = {0};
+    colourClick_calibrate(readRGB(), rgb);
     return rgb;
 }
 
-void colourClick_waitUntilWall(void) {
-    clearInterrupt();
-    while (readInterrupt()) {} // wait until interrupt is triggered (active LOW)
-    return;
+// squared distance in hue and saturation to one of the coloured cards
+static inline uint16_t cardDistance(uint8_t card, const HSLColour *hsl) {
+    int16_t h_dist = 180 - ab(ab((int16_t) CARD_H[card] - (int16_t) hsl->h) - 180); // 0..180
+    int8_t s_dist = (int8_t) (CARD_S[card] - hsl->s);
+    return (uint16_t) (h_dist * h_dist) + (uint16_t) (s_dist * s_dist); // at most 180^2 + 100^2
 }
 
-Card colourClick_readCard(void) {
-//    colourClick_offLED();
-//    __delay_ms(300);
-    // LED is assumed off
-    uint16_t c = readC();
-    if (c > clear_threshold)
-        return CLEAR;
-    
-    // LED on for colour + white/black measurement
-    colourClick_onLED();
-    __delay_ms(READ_DELAY);
-    
-    c = readC();
-    const uint8_t *rgb = readCalibratedRGB();
-    colourClick_offLED();
-    
+// nearest card to white-calibrated rgb, c is the LED-on clear channel
+Card colourClick_classify(const uint8_t *rgb, uint16_t c) {
     // check for white/black
-    uint16_t min = rgb[0];
-    uint16_t max = rgb[0];
-    for (uint8_t i = 1; i < 3; ++i) {
-        if (rgb[i] < min) min = rgb[i];
-        if (rgb[i] > max) max = rgb[i];
-    }
-    if (max - min < range_threshold) { // white or black
-        if (c > white_threshold) {
-            #ifdef __CARD_LED
-                LATDbits.LATD7 = 1;
-                __delay_ms(300);
-                LATDbits.LATD7 = 0;
-            #endif
-            return WHITE;
-        } else {
-            #ifdef __CARD_LED
-                LATHbits.LATH3 = 1;
-                __delay_ms(300);
-                LATHbits.LATH3 = 0;
-            #endif
-            return BLACK;
-        }
+    uint8_t lo = min(rgb[0], min(rgb[1], rgb[2]));
+    uint8_t hi = max(rgb[0], max(rgb[1], rgb[2]));
+    if (hi - lo < range_threshold) { // white or black
+        return c > white_threshold ? WHITE : BLACK;
     }
     
     // check for colour
     const HSLColour *hsl = rgb2hsl(rgb[0], rgb[1], rgb[2]);
-    uint32_t smallest = (uint32_t) 1 << 31;
-    Card card;
+    uint16_t smallest = UINT16_MAX;
+    Card card = RED;
     for (uint8_t i = 0; i < NUM_CARDS; ++i) {
-        int16_t h_dist = 180 - ab(ab((int16_t) CARD_H[i] - (int16_t) hsl->h) - 180);
-        int8_t s_dist = (int8_t) (CARD_S[i] - hsl->s);
-        uint32_t dist = (uint32_t) (h_dist*h_dist + s_dist*s_dist);
+        uint16_t dist = cardDistance(i, hsl);
         if (dist < smallest) {
             smallest = dist;
             card = i;
         }
     }
+    return card;
+}
+
+static inline uint8_t percent(uint32_t part, uint32_t whole) {
+    uint32_t p = part * 100 / whole;
+    return p > 100 ? 100 : (uint8_t) p;
+}
+
+// how far rgb is from changing colourClick_classify()'s mind, 0..100: the gap
+// to the runner-up card relative to its distance, or for white/black the
+// margins to range_threshold and white_threshold; the least of those that apply
+uint8_t colourClick_confidence(const uint8_t *rgb, uint16_t c) {
+    uint8_t range = max(rgb[0], max(rgb[1], rgb[2])) - min(rgb[0], min(rgb[1], rgb[2]));
+    if (range < range_threshold) {
+        uint16_t gap = c > white_threshold ? c - white_threshold : white_threshold - c;
+        return min(percent(range_threshold - range, range_threshold), percent(gap, white_threshold));
+    }
+    
+    const HSLColour *hsl = rgb2hsl(rgb[0], rgb[1], rgb[2]);
+    uint16_t best = UINT16_MAX, second = UINT16_MAX;
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) {
+        uint16_t dist = cardDistance(i, hsl);
+        if (dist < best) {
+            second = best;
+            best = dist;
+        } else if (dist < second) {
+            second = dist;
+        }
+    }
+    uint8_t hue = second == 0 ? 0 : percent(second - best, second);
+    return min(percent(range - range_threshold, range_threshold), hue); // near range_threshold it might be white/black
+}
+
+// same decision as colourClick_classify() from one table load, see cardTable.h
+Card colourClick_lookup(const uint8_t *rgb, uint16_t c) {
+    uint16_t index = cardTable_index(CARD_TABLE_BIN, rgb);
+    uint8_t entry = CARD_TABLE[index >> 1];
+    Card card = (Card) (index & 1 ? entry >> 4 : entry & 0x0f);
+    if (card == CARD_TABLE_ACHROMATIC) {
+        return c > white_threshold ? WHITE : BLACK;
+    }
+    return card;
+}
+
+void colourClick_waitUntilWall(void) {
+    colourClick_setProfile(COLOUR_SEARCH);
+    restartIntegration(); // no stale PRECISE cycle against the SEARCH threshold
+    clearInterrupt();
+    while (readInterrupt()) hal_waitForInterrupt(); // wait until interrupt is triggered (active LOW)
+    return;
+}
+
+// colourClick_readCard() in stages, so motors_search() can overlap the frames with squaring up
+// LED is assumed off. CLEAR is checked on the LED-off frame, which ends squared
+// up against the wall; a reading as the wall interrupt fires always sees a wall.
+void colourClick_beginCard(void) {
+    card_read.clear = false;
+    card_read.frame = 0;
+    colourClick_setProfile(COLOUR_PRECISE);
+}
+
+// the frame integrates over the next colourClick_sampleMs()
+void colourClick_startSample(void) {
+    if (card_read.frame == 1) { // LED-off frame in progress
+        awaitSample(card_read.start_ms);
+        const uint16_t *crgb = readRGBC();
+        card_read.clear = crgb[0] > clear_threshold; // in COLOUR_PRECISE
+        #ifdef __AMBIENT_FRAME
+            for (uint8_t i = 0; i < 4; ++i) card_read.ambient[i] = crgb[i];
+        #endif
+        if (!card_read.clear) colourClick_onLED(); // LED on for colour + white/black measurement
+    }
+    ++card_read.frame;
+    restartIntegration();
+    card_read.start_ms = clock_now_ms();
+}
+
+// what the LED adds to an LED-on RGBC burst
+static void litCounts(const uint16_t *crgb, uint16_t *lit) {
+    for (uint8_t i = 0; i < 4; ++i) {
+        #ifdef __AMBIENT_FRAME // whatever the arena lighting
+            lit[i] = crgb[i] > card_read.ambient[i] ? crgb[i] - card_read.ambient[i] : 0;
+        #else
+            lit[i] = crgb[i];
+        #endif
+    }
+}
+
+#ifdef __CARD_TABLE
+// false once calibration has learned or loaded prototypes the table wasn't generated from
+static bool prototypesLinked(void) {
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) {
+        if (CARD_H[i] != LINKED_H[i] || CARD_S[i] != LINKED_S[i]) return false;
+    }
+    return true;
+}
+#endif
+
+// classify one LED-on RGBC burst
+static Card classifySample(const uint16_t *crgb, uint8_t *confidence) {
+    uint16_t lit[4];
+    litCounts(crgb, lit);
+    uint16_t c = lit[0];
+    uint8_t rgb[3];
+    colourClick_calibrate(lit + 1, rgb);
+    *confidence = colourClick_confidence(rgb, c);
+    
+    #ifdef __CARD_TABLE
+        if (prototypesLinked()) return colourClick_lookup(rgb, c);
+    #endif
+    return colourClick_classify(rgb, c);
+}
+
+// A confident sample decides on its own. Otherwise take up to
+// CARD_MAX_SAMPLES and vote, stopping once the leader can't be overtaken;
+// ties go to the higher total confidence.
+static Card sampleCard(uint8_t *confidence, uint8_t *num_samples) {
+    uint8_t votes[CLEAR] = {0};
+    uint16_t weight[CLEAR] = {0};
+    Card leader = BLACK;
+    for (uint8_t n = 1; ; ++n) {
+        if (n > 1) waitForSample();
+        Card card = classifySample(readRGBC(), confidence);
+        *num_samples = n;
+        if (*confidence >= CARD_CONFIDENCE) return card;
+        
+        ++votes[card];
+        weight[card] += *confidence;
+        uint8_t runner_up = 0;
+        leader = card;
+        for (uint8_t i = 0; i < CLEAR; ++i) {
+            if (votes[i] > votes[leader] || (votes[i] == votes[leader] && weight[i] > weight[leader])) leader = i;
+        }
+        for (uint8_t i = 0; i < CLEAR; ++i) {
+            if (i != leader && votes[i] > runner_up) runner_up = votes[i];
+        }
+        if (n == CARD_MAX_SAMPLES || votes[leader] > runner_up + (CARD_MAX_SAMPLES - n)) break;
+    }
+    ++stats.voted;
+    *confidence = percent(votes[leader], *num_samples); // share of the samples that agreed
+    return leader;
+}
+
+Card colourClick_endCard(void) {
+    if (card_read.clear) {
+        ++stats.reads[CLEAR];
+        stats.confidence = 100;
+        #ifdef __TELEMETRY
+            telemetry_card(CLEAR, stats.confidence, 0);
+        #endif
+        return CLEAR;
+    }
+    awaitSample(card_read.start_ms);
+    
+    uint8_t num_samples;
+    Card card = sampleCard(&stats.confidence, &num_samples);
+    colourClick_offLED();
+    ++stats.reads[card];
+    stats.samples[card] += num_samples;
+    #ifdef __TELEMETRY
+        telemetry_card(card, stats.confidence, num_samples);
+    #endif
     
     #ifdef __CARD_LED // flash detected colour
-        __delay_ms(100);
+        if (card == WHITE || card == BLACK) { // no RGB for these, use the clicker LEDs
+            HalPin pin = card == WHITE ? HAL_RD7_LED : HAL_RH3_LED;
+            hal_gpio_write(pin, 1);
+            clock_sleep_ms(300);
+            hal_gpio_write(pin, 0);
+            return card;
+        }
+        clock_sleep_ms(100);
         colourClick_setLED(CARD_R[card], CARD_G[card], CARD_B[card]);
-        __delay_ms(300);  
+        clock_sleep_ms(300);  
         colourClick_setLED(0, 0, 0);
     #endif
     
     return card;
 }
 
-//uint16_t clear_threshold = 400; // (LED off) above this is CLEAR, below this is wall
-//uint16_t white_threshold = 30000; // (LED on) if C channel is larger than threshold, then white, otherwise black
+const ColourStats *colourClick_getStats(void) {
+    return &stats;
+}
+
+Card colourClick_readCard(void) {
+    colourClick_beginCard();
+    for (uint8_t i = 0; i < COLOUR_CARD_FRAMES; ++i) colourClick_startSample();
+    return colourClick_endCard();
+}
+
+// average of CALIBRATION_SAMPLES card reads, as the classifier sees them
+static void averageCard(uint16_t *crgb) {
+    uint32_t sum[4] = {0};
+    for (uint8_t n = 0; n < CALIBRATION_SAMPLES; ++n) {
+        #ifdef __AMBIENT_FRAME
+            colourClick_offLED();
+            waitForSample();
+            const uint16_t *ambient = readRGBC();
+            for (uint8_t i = 0; i < 4; ++i) card_read.ambient[i] = ambient[i];
+        #endif
+        colourClick_onLED();
+        waitForSample();
+        uint16_t lit[4];
+        litCounts(readRGBC(), lit);
+        for (uint8_t i = 0; i < 4; ++i) sum[i] += lit[i];
+    }
+    colourClick_offLED();
+    for (uint8_t i = 0; i < 4; ++i) crgb[i] = (uint16_t) (sum[i] / CALIBRATION_SAMPLES);
+}
 
+// average LED-off clear channel
+static uint16_t averageC(void) {
+    uint32_t sum = 0;
+    for (uint8_t n = 0; n < CALIBRATION_SAMPLES; ++n) {
+        waitForSample();
+        sum += readC();
+    }
+    return (uint16_t) (sum / CALIBRATION_SAMPLES);
+}
+
+// after a prompt, wait for RF2 (true) or RF3 (false) and its release
+static bool confirm(void) {
+    EUSART4_sendString(" RF2: read; RF3: skip\r\n");
+    bool read = buttons_readInput() == RF2_DOWN;
+    buttons_waitForRelease();
+    return read;
+}
+
+// White balance, then every card presented in turn at the wall: coloured
+// cards set their prototype, white and black set white_threshold, and a wall
+// against open space sets clear_threshold. Each is averaged over
+// CALIBRATION_SAMPLES reads and can be skipped to keep the current value.
 void colourClick_calibrateAll(void) {
-    char buf[50];
     EUSART4_sendString("> CALIBRATING colours <\r\n");
-    __delay_ms(100);
+    clock_sleep_ms(100);
     EUSART4_sendString("RF2: ready; RF3: done\r\n");
-    __delay_ms(100);
+    clock_sleep_ms(100);
+    colourClick_setProfile(COLOUR_PRECISE); // thresholds are calibrated in this profile
     
     // scaler calibration
     while (1) {
-        sprintf(buf, "scalers=%u,%u,%u\r\n", (uint8_t) (rgb_scaler[0] * 100), (uint8_t) (rgb_scaler[1] * 100), (uint8_t) (rgb_scaler[2] * 100)); EUSART4_sendString(buf);
+        log_info("scalers=%q,%q,%q\r\n", rgb_scaler[0], rgb_scaler[1], rgb_scaler[2]);
         EUSART4_sendString("Place buggy at wall against white\r\n");
-        if (buttons_readInput() == RF3_DOWN) break;
-        colourClick_onLED();
-        __delay_ms(READ_DELAY);
-        const uint16_t *white = readRGB();
-        colourClick_offLED();
+        ButtonsState button = buttons_readInput();
+        buttons_waitForRelease();
+        if (button == RF3_DOWN) break;
+        uint16_t crgb[4];
+        averageCard(crgb); // as the classifier sees it
+        const uint16_t *white = crgb + 1;
         uint16_t highest = 0;
         for (uint8_t i = 0; i < 3; ++i) {
             if (white[i] > highest) highest = white[i];
         }
         for (uint8_t i = 0; i < 3; ++i) {
             if (white[i] != 0) {
-                rgb_scaler[i] = (float) highest / white[i];
+                uint32_t scaler = ((uint32_t) highest << 14) / white[i]; // Q2.14
+                rgb_scaler[i] = scaler > UINT16_MAX ? UINT16_MAX : (uint16_t) scaler;
             }
         }
     }
     
-    __delay_ms(300);
+    // card prototypes
+    uint16_t achromatic_c[2]; // WHITE, BLACK
+    bool is_achromatic_read[2] = {false, false}; // otherwise skipped
+    for (uint8_t card = 0; card < CLEAR; ++card) {
+        EUSART4_print("Place buggy at wall against %s.", CARD_NAMES[card]);
+        if (!confirm()) continue;
+        uint16_t crgb[4];
+        averageCard(crgb);
+        if (card >= NUM_CARDS) {
+            achromatic_c[card - WHITE] = crgb[0];
+            is_achromatic_read[card - WHITE] = true;
+            log_info("%s c=%u\r\n", CARD_NAMES[card], crgb[0]);
+            continue;
+        }
+        uint8_t rgb[3];
+        colourClick_calibrate(crgb + 1, rgb);
+        const HSLColour *hsl = rgb2hsl(rgb[0], rgb[1], rgb[2]);
+        CARD_H[card] = hsl->h;
+        CARD_S[card] = hsl->s;
+        log_info("%s h=%u s=%u\r\n", CARD_NAMES[card], CARD_H[card], CARD_S[card]);
+    }
+    if (is_achromatic_read[0] && is_achromatic_read[1]) {
+        white_threshold = (uint16_t) (((uint32_t) achromatic_c[0] + achromatic_c[1]) / 2);
+        if (white_threshold == 0) white_threshold = 1; // colourClick_confidence() divides by it
+    }
+    log_info("white_threshold=%u\r\n", white_threshold);
     
-//    // clear_threshold calibration
-//    colourClick_offLED();
-//    while (1) {
-//        sprintf(buf, "clear_threshold=%u\r\n", clear_threshold); EUSART4_sendString(buf);
-//        EUSART4_sendString("Place buggy at wall against white\r\n");
-//        if (buttons_readInput() == RF3_DOWN) break;
-//        __delay_ms(READ_DELAY);
-//        uint16_t wall = readC();        
-//        EUSART4_sendString("Place buggy away from wall\r\n");
-//        if (buttons_readInput() == RF3_DOWN) break;
-//        __delay_ms(READ_DELAY);
-//        uint16_t clear = readC();
-//        
-//        clear_threshold = (wall + clear) / 2;
-//    }
-//    
-//    __delay_ms(300);
-//
-//    // white_threshold calibration
-//    while (1) {
-//        sprintf(buf, "white_threshold=%u\r\n", white_threshold); EUSART4_sendString(buf);
-//        EUSART4_sendString("Place buggy at wall against white\r\n");
-//        if (buttons_readInput() == RF3_DOWN) break;
-//        colourClick_onLED();
-//        __delay_ms(READ_DELAY);
-//        uint16_t white = readC();
-//        colourClick_offLED();
-//        EUSART4_sendString("Place buggy at wall against black\r\n");
-//        if (buttons_readInput() == RF3_DOWN) break;
-//        colourClick_onLED();
-//        __delay_ms(READ_DELAY);
-//        uint16_t black = readC();
-//        colourClick_offLED();
-//        
-//        white_threshold = (uint16_t) (((uint32_t) black + (uint32_t) white) / 2);
-//    }
+    // clear_threshold calibration, LED off
+    EUSART4_sendString("Place buggy at wall.");
+    if (confirm()) {
+        uint16_t wall = averageC();
+        EUSART4_sendString("Place buggy away from wall.");
+        if (confirm()) {
+            uint16_t clear = averageC();
+            clear_threshold = (uint16_t) (((uint32_t) wall + clear) / 2);
+        }
+    }
+    log_info("clear_threshold=%u\r\n", clear_threshold);
+    colourClick_setProfile(COLOUR_PRECISE); // rescales the wall threshold
+    calibration_save();
     
     EUSART4_sendString(">CALIBRATION complete<\r\n");
 }
@@ -25,6 +25,20 @@ typedef enum {
     BLACK  = 8,
     CLEAR = 9,
 } Card;
+#define NUM_CARDS (CLEAR - 2) // coloured cards, the ones before WHITE and BLACK
+
+// sensor configurations, switched by colourClick_waitUntilWall() and colourClick_beginCard()
+typedef enum {
+    COLOUR_SEARCH, // short integration, high gain: low-latency wall interrupt
+    COLOUR_PRECISE, // long integration: colour read and calibration
+} ColourProfile;
+
+typedef struct {
+    uint16_t reads[CLEAR + 1]; // by the card returned
+    uint16_t samples[CLEAR + 1]; // LED-on samples those reads took
+    uint16_t voted; // reads no single sample was confident of
+    uint8_t confidence; // of the last read: colourClick_confidence(), or for a vote the share of samples that agreed
+} ColourStats;
 
 void colourClick_init(void);
 void colourClick_onLED(void);
@@ -33,7 +47,24 @@ bool readInterrupt(void);
 void clearInterrupt(void);
 void colourClick_waitUntilWall(void);
 Card colourClick_readCard(void);
+// colourClick_readCard() in stages: COLOUR_PRECISE; COLOUR_CARD_FRAMES frames, each
+// started colourClick_sampleMs() after the last; wait for the last and classify
+#define COLOUR_CARD_FRAMES 2 // LED off for the CLEAR check (and ambient), then LED on
+#define CARD_CONFIDENCE 30 // colourClick_confidence() that decides a card from one sample
+#define CARD_MAX_SAMPLES 5 // LED-on samples to vote over when none is confident
+void colourClick_beginCard(void);
+void colourClick_startSample(void); // reads the previous frame first, if any
+Card colourClick_endCard(void);
+Card colourClick_classify(const uint8_t *rgb, uint16_t c);
+Card colourClick_lookup(const uint8_t *rgb, uint16_t c);
+uint8_t colourClick_confidence(const uint8_t *rgb, uint16_t c); // 0..100, margin of colourClick_classify()'s decision
+const ColourStats *colourClick_getStats(void); // cumulative
 void colourClick_calibrateAll(void);
+void colourClick_setProfile(ColourProfile id);
+ColourProfile colourClick_getProfile(void);
+uint16_t colourClick_integrationMs(void); // of the active profile
+uint16_t colourClick_sampleMs(void); // from colourClick_startSample() until the sample is ready
+uint16_t colourClick_cycleMs(void); // integration plus the wait phase, if enabled
 
 #ifdef __CARD_LED
 void colourClick_setLED(uint8_t r, uint8_t g, uint8_t b);
@@ -44,7 +75,10 @@ void colourClick_interruptLED(void);
 #ifdef __DEBUG_MODE
 uint16_t readC(void);
 const uint16_t *readRGB(void);
+const uint16_t *readRGBC(void); // {C, R, G, B}
+bool colourClick_verifyRegisters(void); // register shadow matches the sensor
 const uint8_t *readCalibratedRGB(void);
+void colourClick_calibrate(const uint16_t *raw_rgb, uint8_t *rgb);
 const HSLColour *rgb2hsl(const uint8_t R, const uint8_t G, const uint8_t B);
 #endif
 
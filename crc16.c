@@ -0,0 +1,20 @@
+#include <stdint.h>
+#include "crc16.h"
+
+// one nibble at a time: 32 bytes of table instead of 512, half the shifts of the bitwise loop
+static const uint16_t NIBBLE[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+uint16_t crc16_update(uint16_t crc, uint8_t byte) {
+    crc = (uint16_t) (crc << 4) ^ NIBBLE[(crc >> 12) ^ (byte >> 4)];
+    crc = (uint16_t) (crc << 4) ^ NIBBLE[(crc >> 12) ^ (byte & 0x0f)];
+    return crc;
+}
+
+uint16_t crc16(const uint8_t *bytes, uint8_t length) {
+    uint16_t crc = CRC16_INIT;
+    for (uint8_t i = 0; i < length; ++i) crc = crc16_update(crc, bytes[i]);
+    return crc;
+}
@@ -0,0 +1,14 @@
+#ifndef CRC16_H
+#define	CRC16_H
+
+#include <stdint.h>
+
+// CRC-16/CCITT-FALSE: polynomial 0x1021, MSB first, initial 0xFFFF, no final
+// XOR; "123456789" gives 0x29B1
+
+#define CRC16_INIT 0xFFFF
+
+uint16_t crc16_update(uint16_t crc, uint8_t byte);
+uint16_t crc16(const uint8_t *bytes, uint8_t length); // from CRC16_INIT
+
+#endif	/* CRC16_H */
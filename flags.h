@@ -2,7 +2,13 @@
 #define	FLAGS_H
 
 #define __DECELERATION
+#define __MOTOR_DEADLINE // motion scripts switch the motors from a high-priority one-shot timer, otherwise from the tick
+#define __S_CURVE // jerk-limited S-curve ramps for the motion primitives, otherwise linear (trapezoidal profile)
 #define __BLINKERS
+//#define __CARD_TABLE // classify cards from cardTable.c instead of HSL distances; 24.8KB of flash, see README
+#define __AMBIENT_FRAME // classify cards on an LED-on frame minus an LED-off frame
+#define __TELEMETRY // binary telemetry records on EUSART4, see telemetry.h
+#define __LOG_LEVEL LOG_INFO // text logs above this level compile to nothing, see serial.h
 
 #define __DEBUG_MODE
 
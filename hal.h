@@ -0,0 +1,117 @@
+#ifndef HAL_H
+#define	HAL_H
+
+// Thin hardware abstraction layer between the buggy modules and the PIC18.
+// Two backends implement it:
+//   hal_xc8.c          - PIC18 registers (CCP PWM, LATx/PORTx, TMR0, EUSART4, MSSP2, NVM)
+//   host/hal_linux.c   - in-memory model used by the host build (see host/)
+// The I2C2 transaction engine in i2c.c sits on top of the MSSP part.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c.h"
+#include "flags.h"
+
+#ifdef __XC8
+#include <xc.h>
+#ifndef _XTAL_FREQ
+#define _XTAL_FREQ 64000000
+#endif
+#endif
+
+// -------------------- GPIO --------------------
+
+typedef enum {
+    HAL_BRAKE_LED,  // RD4
+    HAL_LEFT_LED,   // RF0
+    HAL_RIGHT_LED,  // RH0
+    HAL_LAMP_LED,   // RH1
+    HAL_BEAM_LED,   // RD3
+    HAL_RD7_LED,    // clicker board LED
+    HAL_RH3_LED,    // clicker board LED
+    HAL_CARD_R,     // ColourClick RGB LED
+    HAL_CARD_G,
+    HAL_CARD_B,
+    HAL_RF2_BUTTON, // active LOW
+    HAL_RF3_BUTTON, // active LOW
+    HAL_COLOUR_INT, // ColourClick interrupt, active LOW
+    HAL_NUM_PINS,
+} HalPin;
+
+void hal_gpio_setOutput(HalPin pin);
+void hal_gpio_setInput(HalPin pin);
+void hal_gpio_write(HalPin pin, bool value);
+void hal_gpio_toggle(HalPin pin);
+bool hal_gpio_read(HalPin pin);
+
+// -------------------- PWM --------------------
+
+typedef enum {
+    HAL_PWM_LEFT_POS,  // CCP1 on RE2
+    HAL_PWM_LEFT_NEG,  // CCP2 on RE4
+    HAL_PWM_RIGHT_POS, // CCP3 on RC7
+    HAL_PWM_RIGHT_NEG, // CCP4 on RG6
+    HAL_NUM_PWM,
+} HalPwmChannel;
+
+void hal_pwm_init(uint8_t period); // all channels share the period, duty is 0..period
+void hal_pwm_setDuty(HalPwmChannel channel, uint8_t duty);
+
+// -------------------- Clock --------------------
+
+void hal_clock_init(void); // 1kHz tick
+void hal_clock_tick(void); // called from the 1kHz tick interrupt
+uint32_t hal_clock_ms(void); // monotonic milliseconds since hal_clock_init()
+uint16_t hal_clock_phaseUs(void); // microseconds since the last tick
+void hal_delay_ms(uint16_t ms); // use clock_sleep_ms(), which accounts for the wait
+
+#ifdef __CARD_LED
+void hal_ledTimer_init(void); // periodic interrupt for software RGB LED PWM
+#endif
+
+// -------------------- Deadline --------------------
+
+// One-shot timer on the high-priority interrupt, which calls motors_deadline()
+// at the next tick. The motion scripts stage their duties a millisecond ahead
+// and switch the motors here, whatever lower-priority interrupt is running.
+void hal_deadline_arm(void); // again to move an armed deadline to the next tick
+void hal_deadline_cancel(void);
+
+// -------------------- I2C --------------------
+
+// MSSP2 in I2C master mode, one bus event at a time: each call starts an
+// event and the backend calls I2C2_interrupt() when it has finished.
+void hal_i2c_init(void); // 100kHz
+void hal_i2c_start(void);
+void hal_i2c_repeatStart(void);
+void hal_i2c_stop(void);
+void hal_i2c_write(uint8_t byte);
+bool hal_i2c_acked(void); // slave acknowledged the last write
+void hal_i2c_receive(void);
+uint8_t hal_i2c_read(void); // byte from the last receive
+void hal_i2c_ack(bool ack); // acknowledge (more to read) or not (last byte)
+void hal_i2c_recover(void); // clock a stuck slave off SDA and reset the MSSP
+
+// -------------------- Interrupts --------------------
+
+bool hal_irq_disable(void); // returns whether interrupts were enabled
+void hal_irq_restore(bool enabled);
+void hal_waitForInterrupt(void); // lets an interrupt-driven wait make progress
+
+// -------------------- UART --------------------
+
+#define HAL_UART_BAUD 230400 // BRG16 and BRGH: 64MHz / (4 * (68 + 1)) = 231884, +0.6%
+
+void hal_uart_init(void); // EUSART4, 8N1 at HAL_UART_BAUD
+void hal_uart_kickTX(void); // start draining the TX ring buffer
+
+// -------------------- EEPROM --------------------
+
+#define HAL_EEPROM_SIZE 1024 // bytes of data EEPROM, erased to 0xFF
+
+// A write erases and writes one byte in the background (~4ms); the next
+// read or write waits for it to finish.
+uint8_t hal_eeprom_read(uint16_t address);
+void hal_eeprom_write(uint16_t address, uint8_t value);
+
+#endif	/* HAL_H */
@@ -0,0 +1,399 @@
+#include <xc.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal.h"
+#include "flags.h"
+
+#define TMR0_FREQ 16e6 / 64
+
+#define TMR2_FREQ 16e6 / 16
+#define PWM_FREQ 200 // frequency of LED flashing
+#define I2C_CLOCK 100000 // 100kHz
+
+volatile uint32_t hal_elapsed_ms = 0;
+
+// -------------------- START GPIO --------------------
+
+void hal_gpio_setOutput(HalPin pin) {
+    switch (pin) {
+        case HAL_BRAKE_LED: TRISDbits.TRISD4 = 0; break;
+        case HAL_LEFT_LED: TRISFbits.TRISF0 = 0; break;
+        case HAL_RIGHT_LED: TRISHbits.TRISH0 = 0; break;
+        case HAL_LAMP_LED: TRISHbits.TRISH1 = 0; break;
+        case HAL_BEAM_LED: TRISDbits.TRISD3 = 0; break;
+        case HAL_RD7_LED: TRISDbits.TRISD7 = 0; break;
+        case HAL_RH3_LED: TRISHbits.TRISH3 = 0; break;
+        #ifdef __ONBOARD
+        case HAL_CARD_R: TRISAbits.TRISA0 = 0; break;
+        case HAL_CARD_G: TRISDbits.TRISD0 = 0; break;
+        case HAL_CARD_B: TRISCbits.TRISC2 = 0; break;
+        #else
+        case HAL_CARD_R: TRISGbits.TRISG1 = 0; break;
+        case HAL_CARD_G: TRISAbits.TRISA4 = 0; break;
+        case HAL_CARD_B: TRISFbits.TRISF7 = 0; break;
+        #endif
+        default: break; // inputs only
+    }
+}
+
+void hal_gpio_setInput(HalPin pin) {
+    switch (pin) {
+        case HAL_RF2_BUTTON:
+            TRISFbits.TRISF2 = 1; // input
+            ANSELFbits.ANSELF2 = 0; // digital
+            break;
+        case HAL_RF3_BUTTON:
+            TRISFbits.TRISF3 = 1; // input
+            ANSELFbits.ANSELF3 = 0; // digital
+            break;
+        case HAL_COLOUR_INT:
+            TRISBbits.TRISB1 = 1; // input
+            ANSELBbits.ANSELB1 = 0; // digital
+            break;
+        default: break; // outputs only
+    }
+}
+
+void hal_gpio_write(HalPin pin, bool value) {
+    switch (pin) {
+        case HAL_BRAKE_LED: LATDbits.LATD4 = value; break;
+        case HAL_LEFT_LED: LATFbits.LATF0 = value; break;
+        case HAL_RIGHT_LED: LATHbits.LATH0 = value; break;
+        case HAL_LAMP_LED: LATHbits.LATH1 = value; break;
+        case HAL_BEAM_LED: LATDbits.LATD3 = value; break;
+        case HAL_RD7_LED: LATDbits.LATD7 = value; break;
+        case HAL_RH3_LED: LATHbits.LATH3 = value; break;
+        #ifdef __ONBOARD
+        case HAL_CARD_R: LATAbits.LATA0 = value; break;
+        case HAL_CARD_G: LATDbits.LATD0 = value; break;
+        case HAL_CARD_B: LATCbits.LATC2 = value; break;
+        #else
+        case HAL_CARD_R: LATGbits.LATG1 = value; break;
+        case HAL_CARD_G: LATAbits.LATA4 = value; break;
+        case HAL_CARD_B: LATFbits.LATF7 = value; break;
+        #endif
+        default: break; // inputs only
+    }
+}
+
+void hal_gpio_toggle(HalPin pin) {
+    switch (pin) {
+        case HAL_BRAKE_LED: LATDbits.LATD4 = ~LATDbits.LATD4; break;
+        case HAL_LEFT_LED: LATFbits.LATF0 = ~LATFbits.LATF0; break;
+        case HAL_RIGHT_LED: LATHbits.LATH0 = ~LATHbits.LATH0; break;
+        default: hal_gpio_write(pin, !hal_gpio_read(pin)); break;
+    }
+}
+
+bool hal_gpio_read(HalPin pin) {
+    switch (pin) {
+        case HAL_RF2_BUTTON: return PORTFbits.RF2;
+        case HAL_RF3_BUTTON: return PORTFbits.RF3;
+        case HAL_COLOUR_INT: return PORTBbits.RB1;
+        case HAL_RD7_LED: return LATDbits.LATD7;
+        case HAL_RH3_LED: return LATHbits.LATH3;
+        case HAL_LAMP_LED: return LATHbits.LATH1;
+        case HAL_BEAM_LED: return LATDbits.LATD3;
+        default: return false;
+    }
+}
+
+// -------------------- END GPIO --------------------
+// -------------------- START PWM --------------------
+
+// initialise T2 and CCP1-4 for DC motor control
+void hal_pwm_init(uint8_t period) {
+    // TRIS and LAT registers for PWM
+    TRISEbits.TRISE2 = 0; // output
+    TRISEbits.TRISE4 = 0; // output
+    TRISCbits.TRISC7 = 0; // output
+    TRISGbits.TRISG6 = 0; // output
+
+    // configure PPS to map CCP modules to pins
+    RE2PPS = 0x05; //CCP1 on RE2
+    RE4PPS = 0x06; //CCP2 on RE4
+    RC7PPS = 0x07; //CCP3 on RC7
+    RG6PPS = 0x08; //CCP4 on RG6
+
+    // TMR2 config
+    T2CONbits.CKPS = 0b100; // 1:16 prescaler
+    T2HLTbits.MODE = 0b00000; // free Running Mode, software gate only
+    T2CLKCONbits.CS = 0b0001; // Fosc/4
+    T2PR = period;
+    T2CONbits.ON = 1;
+
+    // setup CCP modules to output PMW signals
+    // initial duty cycles
+    CCPR1H = 0;
+    CCPR2H = 0;
+    CCPR3H = 0;
+    CCPR4H = 0;
+
+    //use tmr2 for all CCP modules used
+    CCPTMRS0bits.C1TSEL = 0;
+    CCPTMRS0bits.C2TSEL = 0;
+    CCPTMRS0bits.C3TSEL = 0;
+    CCPTMRS0bits.C4TSEL = 0;
+
+    //configure each CCP
+    CCP1CONbits.FMT = 1; // left aligned duty cycle (we can just use high byte)
+    CCP1CONbits.CCP1MODE = 0b1100; // PWM mode
+    CCP1CONbits.EN = 1; //turn on
+
+    CCP2CONbits.FMT = 1; // left aligned
+    CCP2CONbits.CCP2MODE = 0b1100; // PWM mode
+    CCP2CONbits.EN = 1; //turn on
+
+    CCP3CONbits.FMT = 1; // left aligned
+    CCP3CONbits.CCP3MODE = 0b1100; // PWM mode
+    CCP3CONbits.EN = 1; //turn on
+
+    CCP4CONbits.FMT = 1; // left aligned
+    CCP4CONbits.CCP4MODE = 0b1100; // PWM mode
+    CCP4CONbits.EN = 1; //turn on
+}
+
+void hal_pwm_setDuty(HalPwmChannel channel, uint8_t duty) {
+    switch (channel) {
+        case HAL_PWM_LEFT_POS: CCPR1H = duty; break;
+        case HAL_PWM_LEFT_NEG: CCPR2H = duty; break;
+        case HAL_PWM_RIGHT_POS: CCPR3H = duty; break;
+        case HAL_PWM_RIGHT_NEG: CCPR4H = duty; break;
+        default: break;
+    }
+}
+
+// -------------------- END PWM --------------------
+// -------------------- START CLOCK --------------------
+
+void hal_clock_init(void) {
+    // Timer0 configuration
+    T0CON0bits.T016BIT = 0; // timer is 8-bit
+    T0CON0bits.T0OUTPS = 0b0000; // 1:1 post-scaler
+    T0CON1bits.T0CS = 0b010; // Fosc/4 timer source
+    T0CON1bits.T0ASYNC = 0; // timer is synchronised to Fosc/4 (see errata)
+    T0CON1bits.T0CKPS = 0b0110; // 1:64 pre-scaler
+    TMR0H = (uint8_t) ((uint32_t) TMR0_FREQ / 1000) - 1; // 1000Hz
+    TMR0L = 0;
+    T0CON0bits.T0EN = 1; // enable timer
+}
+
+void hal_clock_tick(void) {
+    ++hal_elapsed_ms;
+}
+
+uint32_t hal_clock_ms(void) {
+    uint32_t ms;
+    do { // 32-bit read is not atomic on the PIC18, re-read if the ISR ticked in between
+        ms = hal_elapsed_ms;
+    } while (ms != hal_elapsed_ms);
+    return ms;
+}
+
+uint16_t hal_clock_phaseUs(void) {
+    return (uint16_t) TMR0L * (uint16_t) (1e6 / (TMR0_FREQ)); // 4us per count
+}
+
+void hal_delay_ms(uint16_t ms) {
+    uint32_t start = hal_clock_ms();
+    while (hal_clock_ms() - start < ms) {}
+}
+
+#ifdef __CARD_LED
+void hal_ledTimer_init(void) { // TODO Timer2 is not running at the right frequency
+    // Timer2 configuration
+    T2CONbits.CKPS = 0b100; // 1:16 pre-scaler
+    T2CONbits.OUTPS = 0b0000; // 1:1 post-scaler
+    T2CLKCONbits.CS = 0b0001; // Fosc/4 timer source
+    T2HLTbits.PSYNC = 1; // timer is synchronised to Fosc/4
+    T2HLTbits.MODE = 0b00000; // free running period mode
+    T2PR = (uint8_t) ((uint32_t) TMR2_FREQ / PWM_FREQ / 256) - 1;
+    T2TMR = 0;
+    T2CONbits.ON = 1; // timer enabled
+}
+#endif
+
+// -------------------- END CLOCK --------------------
+// -------------------- START DEADLINE --------------------
+
+// Timer4 in one-shot mode at the TMR0 count rate, started with the counts
+// left until TMR0 next matches; the hardware clears ON at the match. Its
+// prescaler isn't in step with TMR0's, so it can fire a count (4us) either
+// side of the tick; motors_deadline() copes with both, and counts a phase
+// just short of TMR0H as on time rather than a whole tick late. It isn't
+// started a count later, which would give the tick longer to re-arm it first.
+void hal_deadline_arm(void) {
+    T4CONbits.ON = 0;
+    T4CLKCONbits.CS = 0b0001; // Fosc/4 timer source
+    T4CONbits.CKPS = 0b110; // 1:64 pre-scaler, as TMR0
+    T4CONbits.OUTPS = 0b0000; // 1:1 post-scaler
+    T4HLTbits.PSYNC = 1; // timer is synchronised to Fosc/4
+    T4HLTbits.MODE = 0b01000; // one-shot, software start
+    T4TMR = 0;
+    T4PR = TMR0H - TMR0L; // to the next tick
+    PIR5bits.TMR4IF = 0;
+    PIE5bits.TMR4IE = 1;
+    T4CONbits.ON = 1;
+}
+
+void hal_deadline_cancel(void) {
+    T4CONbits.ON = 0;
+    PIR5bits.TMR4IF = 0;
+}
+
+// -------------------- END DEADLINE --------------------
+// -------------------- START I2C --------------------
+
+// MSSP2 signals the end of every event below with SSP2IF, see interrupts.c
+void hal_i2c_init(void) {
+    SSP2CON1bits.SSPM = 0b1000; // i2c master mode
+    SSP2CON1bits.SSPEN = 1; // enable i2c
+    SSP2ADD = (_XTAL_FREQ / (4 * I2C_CLOCK)) - 1; // baud rate divider bits (in master mode)
+
+    // pin configuration for i2c
+    TRISDbits.TRISD5 = 1; // disable output driver
+    TRISDbits.TRISD6 = 1; // disable output driver
+    ANSELDbits.ANSELD5 = 0; // digital mode
+    ANSELDbits.ANSELD6 = 0; // digital mode
+    SSP2DATPPS = 0x1D; // SDA on pin RD5
+    SSP2CLKPPS = 0x1E; // SCL on pin RD6
+    RD5PPS = 0x1C; // data output
+    RD6PPS = 0x1B; // clock output
+}
+
+void hal_i2c_start(void) {
+    SSP2CON2bits.SEN = 1;
+}
+
+void hal_i2c_repeatStart(void) {
+    SSP2CON2bits.RSEN = 1;
+}
+
+void hal_i2c_stop(void) {
+    SSP2CON2bits.PEN = 1;
+}
+
+void hal_i2c_write(uint8_t byte) {
+    SSP2BUF = byte;
+}
+
+bool hal_i2c_acked(void) {
+    return !SSP2CON2bits.ACKSTAT; // acknowledge is active LOW
+}
+
+void hal_i2c_receive(void) {
+    SSP2CON2bits.RCEN = 1; // put the module into receive mode
+}
+
+uint8_t hal_i2c_read(void) {
+    return SSP2BUF;
+}
+
+void hal_i2c_ack(bool ack) {
+    SSP2CON2bits.ACKDT = !ack; // acknowledge bit is active LOW
+    SSP2CON2bits.ACKEN = 1; // start acknowledge sequence
+}
+
+void hal_i2c_recover(void) {
+    SSP2CON1bits.SSPEN = 0; // release the pins to the port latches
+    RD5PPS = 0;
+    RD6PPS = 0;
+    LATDbits.LATD5 = 0;
+    LATDbits.LATD6 = 0;
+    // clock SCL by switching the open drain until the slave lets go of SDA, at most one byte and the ack
+    for (uint8_t i = 0; i < 9 && !PORTDbits.RD5; ++i) {
+        TRISDbits.TRISD6 = 0; // SCL low
+        __delay_us(5);
+        TRISDbits.TRISD6 = 1; // SCL released high
+        __delay_us(5);
+    }
+    // stop: SDA rises while SCL is high
+    TRISDbits.TRISD5 = 0;
+    __delay_us(5);
+    TRISDbits.TRISD5 = 1;
+    __delay_us(5);
+    PIR3bits.BCL2IF = 0;
+    PIR3bits.SSP2IF = 0;
+    hal_i2c_init();
+}
+
+// -------------------- END I2C --------------------
+// -------------------- START INTERRUPTS --------------------
+
+bool hal_irq_disable(void) {
+    bool enabled = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+    return enabled;
+}
+
+void hal_irq_restore(bool enabled) {
+    INTCONbits.GIE = enabled;
+}
+
+void hal_waitForInterrupt(void) {
+    // nothing to do, the interrupt runs on its own
+}
+
+// -------------------- END INTERRUPTS --------------------
+// -------------------- START UART --------------------
+
+void hal_uart_init(void) {
+    // setup PPS mapping of EUSART TX/RX
+    RC0PPS = 0x12; // map EUSART4 TX to output at C0
+    RX4PPS = 0b00010001; // map EUSART RX to input at C1
+    //           | |+++------- PIN 1
+    //           +++---------- PORT C
+
+    // setup EUSART4
+    BAUD4CONbits.SCKP = 0; // idle TX state is high level (non-inverted)
+    BAUD4CONbits.BRG16 = 1; // 16-bit baud rate generator
+    BAUD4CONbits.WUE = 0; // disable wake-up enable bit
+    BAUD4CONbits.ABDEN = 0; // disable auto-baud detect
+    TX4STAbits.TX9 = 0; // 8-bit transmit
+    TX4STAbits.SYNC = 0; // asynchronous mode
+    TX4STAbits.SENDB = 0; // disable break bit
+    TX4STAbits.BRGH = 1; // high speed baud rate
+    RC4STAbits.RX9 = 0; // 8-bit reception
+    RC4STAbits.CREN = 1; // enable continuous reception
+    uint16_t n = (uint16_t) ((_XTAL_FREQ + 2UL * HAL_UART_BAUD) / (4UL * HAL_UART_BAUD) - 1); // baudrate = 64e6/(4*(n+1)), rounded
+    SP4BRGL = n & 0xff;
+    SP4BRGH = n >> 8;
+
+    TX4STAbits.TXEN = 1; // enable TX
+    RC4STAbits.SPEN = 1; // enable RX serial port
+}
+
+void hal_uart_kickTX(void) {
+    PIE4bits.TX4IE = 1; // enable TX interrupt to send content
+}
+
+// -------------------- END UART --------------------
+// -------------------- START EEPROM --------------------
+
+// waits for the last write, then points the NVM at a data EEPROM byte
+static void selectEEPROM(uint16_t address) {
+    while (NVMCON1bits.WR) {} // self-timed erase and write
+    NVMCON1bits.WREN = 0;
+    NVMCON1bits.NVMREG = 0b00; // data EEPROM
+    NVMADRL = address & 0xff;
+    NVMADRH = (address >> 8) & 0x03;
+}
+
+uint8_t hal_eeprom_read(uint16_t address) {
+    selectEEPROM(address);
+    NVMCON1bits.RD = 1;
+    return NVMDAT;
+}
+
+void hal_eeprom_write(uint16_t address, uint8_t value) {
+    selectEEPROM(address);
+    NVMDAT = value;
+    NVMCON1bits.WREN = 1;
+    bool enabled = hal_irq_disable(); // the unlock sequence must not be interrupted
+    NVMCON2 = 0x55;
+    NVMCON2 = 0xAA;
+    NVMCON1bits.WR = 1;
+    hal_irq_restore(enabled);
+}
+
+// -------------------- END EEPROM --------------------
@@ -0,0 +1,114 @@
+// Round-trips the calibration record (calibration.c) through the EEPROM mock
+// in hal_linux.c: a saved record loads back, saving it unchanged rewrites
+// nothing, and an erased EEPROM, a corrupt payload byte or CRC, a wrong
+// version or a wrong length is rejected with every value left as it was.
+//
+//   make -C host calibration_mock && ./host/build/calibration_mock
+//
+// Exits non-zero if any check fails.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_linux.h"
+#include "../calibration.h"
+#include "../colourClick.h"
+#include "../crc16.h"
+
+#define VERSION_OFFSET 2 // magic, then version and payload length
+#define LENGTH_OFFSET 3
+#define PAYLOAD_OFFSET 4
+
+// a sample of the fields, from both modules and of each size
+extern int8_t turn_power;
+extern uint16_t forward_fast_duration;
+extern uint16_t rgb_scaler[];
+extern uint16_t white_threshold;
+extern uint16_t CARD_H[];
+extern uint16_t CARD_S[];
+
+typedef struct {
+    int8_t turn_power;
+    uint16_t forward_fast_duration;
+    uint16_t rgb_scaler_g;
+    uint16_t white_threshold;
+    uint16_t card_h_red;
+    uint16_t card_s_lblue;
+} Values;
+
+static const Values SAVED = {47, 777, 20000, 12345, 10, 99};
+static Values defaults; // compiled in
+
+static bool failed;
+
+static void check(bool ok, const char *what) {
+    printf("%s  %s\n", ok ? "ok  " : "FAIL", what);
+    if (!ok) failed = true;
+}
+
+static Values get(void) {
+    return (Values) {turn_power, forward_fast_duration, rgb_scaler[1], white_threshold, CARD_H[RED], CARD_S[LBLUE]};
+}
+
+static void set(const Values *values) {
+    turn_power = values->turn_power;
+    forward_fast_duration = values->forward_fast_duration;
+    rgb_scaler[1] = values->rgb_scaler_g;
+    white_threshold = values->white_threshold;
+    CARD_H[RED] = values->card_h_red;
+    CARD_S[LBLUE] = values->card_s_lblue;
+}
+
+static bool equals(const Values *values) {
+    return turn_power == values->turn_power && forward_fast_duration == values->forward_fast_duration
+            && rgb_scaler[1] == values->rgb_scaler_g && white_threshold == values->white_threshold
+            && CARD_H[RED] == values->card_h_red && CARD_S[LBLUE] == values->card_s_lblue;
+}
+
+// CRC over everything before it, so only the field under test is wrong
+static void reseal(void) {
+    uint16_t crc_address = CALIBRATION_ADDRESS + calibration_size() - 2;
+    uint16_t crc = CRC16_INIT;
+    for (uint16_t address = CALIBRATION_ADDRESS; address < crc_address; ++address) crc = crc16_update(crc, hal_eeprom_read(address));
+    hal_eeprom_write(crc_address, crc & 0xff);
+    hal_eeprom_write(crc_address + 1, crc >> 8);
+}
+
+// the record is rejected with one byte changed, and loads again once it is put back
+static void rejects(uint16_t offset, uint8_t xor, bool is_resealed, const char *what) {
+    uint16_t address = CALIBRATION_ADDRESS + offset;
+    uint8_t good = hal_eeprom_read(address);
+    hal_eeprom_write(address, good ^ xor);
+    if (is_resealed) reseal();
+    set(&defaults);
+    char line[96];
+    snprintf(line, sizeof(line), "%s is rejected and the defaults kept", what);
+    check(!calibration_load() && equals(&defaults), line);
+    hal_eeprom_write(address, good);
+    if (is_resealed) reseal();
+}
+
+int main(void) {
+    hal_linux_reset();
+    defaults = get();
+    check(!calibration_load() && equals(&defaults), "erased EEPROM is rejected and the defaults kept");
+
+    set(&SAVED);
+    calibration_save();
+    uint32_t writes = hal_linux_eepromWrites();
+    printf("      record is %u bytes, %lu written\n", calibration_size(), (unsigned long) writes);
+    check(writes == calibration_size(), "first save writes the whole record");
+    calibration_save();
+    check(hal_linux_eepromWrites() == writes, "saving unchanged values rewrites nothing");
+    set(&defaults);
+    check(calibration_load() && equals(&SAVED), "saved record loads back");
+
+    rejects(PAYLOAD_OFFSET + 1, 0x01, false, "a corrupt payload byte");
+    rejects(calibration_size() - 1, 0x80, false, "a corrupt CRC");
+    rejects(VERSION_OFFSET, 0x01, true, "another version, with a valid CRC,");
+    rejects(LENGTH_OFFSET, 0x02, true, "another payload length, with a valid CRC,");
+
+    set(&defaults);
+    check(calibration_load() && equals(&SAVED), "restored record loads again");
+    return failed ? 1 : 0;
+}
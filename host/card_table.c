@@ -0,0 +1,213 @@
+// Generates cardTable.c, the card table behind colourClick_lookup(), from the
+// HSL classifier (CARD_H/CARD_S and range_threshold as linked), and reports
+// where the table disagrees with colourClick_classify().
+//
+//   make -C host card_table && ./host/build/card_table [-s samples.txt] [-o cardTable.c]
+//
+// Every calibrated RGB value votes for colourClick_classify()'s card in its
+// cell and each cell keeps the winner. With -s, cells that recorded readings
+// fall into are voted on by those readings only, so the table is tuned to what
+// the sensor actually sees. A samples file has one raw LED-on reading per
+// line: "<c> <r> <g> <b>", as for colour_bench.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "../colourClick.h"
+#include "../cardTable.h"
+
+#define NUM_CODES (CLEAR + 1)
+#define NUM_BINS (1 << CARD_TABLE_OFFSET_BITS)
+#define BIN_GAMMA 0.7 // < 1: finer bins for small offsets, where hue moves fastest
+
+extern uint16_t CARD_H[];
+extern uint16_t CARD_S[];
+extern uint8_t range_threshold;
+extern uint16_t white_threshold;
+
+static const char *const CARD_NAMES[NUM_CODES] = {"RED", "GREEN", "DBLUE", "YELLOW", "PINK", "ORANGE", "LBLUE", "WHITE", "BLACK", "CLEAR"};
+
+static uint8_t bins[256];
+static uint8_t table[CARD_TABLE_ENTRIES]; // one code per entry, packed on output
+static uint8_t *codes; // colourClick_classify() for every calibrated RGB, [r << 16 | g << 8 | b]
+static uint32_t (*votes)[NUM_CODES]; // per entry, only used with -s
+
+// the classifier's decision without the clear channel: colour, or achromatic
+static inline Card reference(const uint8_t *rgb) {
+    Card card = colourClick_classify(rgb, 0);
+    return card == BLACK || card == WHITE ? CARD_TABLE_ACHROMATIC : card;
+}
+
+static inline Card lookup(const uint8_t *rgb, uint16_t c) {
+    Card code = table[cardTable_index(bins, rgb)];
+    if (code == CARD_TABLE_ACHROMATIC) return c > white_threshold ? WHITE : BLACK;
+    return code;
+}
+
+// bin 0 is exactly the offsets below range_threshold, the rest spread up to 255
+static void makeBins(void) {
+    for (uint16_t x = 0; x < 256; ++x) {
+        if (x < range_threshold) {
+            bins[x] = 0;
+            continue;
+        }
+        double t = (double) (x - range_threshold) / (255 - range_threshold);
+        uint16_t bin = 1 + (uint16_t) (pow(t, BIN_GAMMA) * (NUM_BINS - 1));
+        bins[x] = (uint8_t) (bin < NUM_BINS ? bin : NUM_BINS - 1);
+    }
+}
+
+static void generate(void) {
+    static uint32_t count[CARD_TABLE_ENTRIES][NUM_CODES];
+    codes = malloc(1UL << 24);
+    for (uint32_t i = 0; i < (1UL << 24); ++i) {
+        uint8_t rgb[3] = {(uint8_t) (i >> 16), (uint8_t) (i >> 8), (uint8_t) i};
+        codes[i] = reference(rgb);
+        ++count[cardTable_index(bins, rgb)][codes[i]];
+    }
+    for (uint32_t index = 0; index < CARD_TABLE_ENTRIES; ++index) {
+        uint32_t *vote = count[index];
+        if (votes != NULL) {
+            uint32_t total = 0;
+            for (uint8_t i = 0; i < NUM_CODES; ++i) total += votes[index][i];
+            if (total > 0) vote = votes[index];
+        }
+        uint8_t best = 0;
+        for (uint8_t i = 1; i < NUM_CODES; ++i) {
+            if (vote[i] > vote[best]) best = i;
+        }
+        table[index] = best;
+    }
+}
+
+static bool loadVotes(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    votes = calloc(CARD_TABLE_ENTRIES, sizeof(*votes));
+    unsigned c, r, g, b;
+    size_t n = 0;
+    while (fscanf(file, "%u %u %u %u", &c, &r, &g, &b) == 4) {
+        uint16_t raw[3] = {(uint16_t) r, (uint16_t) g, (uint16_t) b};
+        uint8_t rgb[3];
+        colourClick_calibrate(raw, rgb);
+        ++votes[cardTable_index(bins, rgb)][reference(rgb)];
+        ++n;
+    }
+    fclose(file);
+    printf("%s: %zu samples voted\n", path, n);
+    return true;
+}
+
+static void writeBytes(FILE *file, const char *decl, const uint8_t *bytes, uint32_t size) {
+    fprintf(file, "%s = {\n", decl);
+    for (uint32_t i = 0; i < size; ++i) {
+        if (i % 16 == 0) fprintf(file, "   ");
+        fprintf(file, " 0x%02x,", bytes[i]);
+        if (i % 16 == 15 || i == size - 1) fprintf(file, "\n");
+    }
+    fprintf(file, "};\n");
+}
+
+static bool writeTable(const char *path) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    static uint8_t packed[CARD_TABLE_BYTES];
+    for (uint32_t i = 0; i < CARD_TABLE_BYTES; ++i) packed[i] = (uint8_t) (table[2 * i] | table[2 * i + 1] << 4);
+
+    fprintf(file, "// Generated by host/card_table, do not edit. See cardTable.h.\n");
+    fprintf(file, "// CARD_H = {");
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) fprintf(file, i ? ", %u" : "%u", CARD_H[i]);
+    fprintf(file, "}, CARD_S = {");
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) fprintf(file, i ? ", %u" : "%u", CARD_S[i]);
+    fprintf(file, "}, range_threshold = %u\n\n", range_threshold);
+    fprintf(file, "#include \"cardTable.h\"\n\n");
+    writeBytes(file, "const uint8_t CARD_TABLE_BIN[256]", bins, sizeof(bins));
+    fprintf(file, "\n");
+    writeBytes(file, "const uint8_t CARD_TABLE[CARD_TABLE_BYTES]", packed, CARD_TABLE_BYTES);
+    fclose(file);
+    printf("wrote %s (%lu bytes of program memory)\n", path, (unsigned long) (sizeof(bins) + CARD_TABLE_BYTES));
+    return true;
+}
+
+// every calibrated RGB against colourClick_classify(), by the card it should be
+static void report(void) {
+    uint32_t diff[NUM_CODES] = {0}, total[NUM_CODES] = {0};
+    for (uint32_t i = 0; i < (1UL << 24); ++i) {
+        uint8_t rgb[3] = {(uint8_t) (i >> 16), (uint8_t) (i >> 8), (uint8_t) i};
+        ++total[codes[i]];
+        if (table[cardTable_index(bins, rgb)] != codes[i]) ++diff[codes[i]];
+    }
+    uint32_t all = 0;
+    printf("table vs classifier over all calibrated RGB:\n");
+    for (uint8_t i = 0; i < NUM_CODES; ++i) {
+        if (total[i] == 0) continue;
+        const char *name = i == CARD_TABLE_ACHROMATIC ? "white/black" : CARD_NAMES[i];
+        printf("  %-12s %8lu of %8lu differ (%.2f%%)\n", name, (unsigned long) diff[i], (unsigned long) total[i],
+                100.0 * diff[i] / total[i]);
+        all += diff[i];
+    }
+    printf("  %-12s %8lu of %8lu differ (%.2f%%)\n", "total", (unsigned long) all, 1UL << 24, 100.0 * all / (1UL << 24));
+
+    // stale if the linked table differs
+    uint32_t stale = memcmp(bins, CARD_TABLE_BIN, sizeof(bins)) != 0 ? CARD_TABLE_ENTRIES : 0;
+    for (uint32_t index = 0; stale == 0 && index < CARD_TABLE_ENTRIES; ++index) {
+        uint8_t entry = CARD_TABLE[index >> 1];
+        if ((index & 1 ? entry >> 4 : entry & 0x0f) != table[index]) ++stale;
+    }
+    printf("entries changed from the linked cardTable.c: %lu\n", (unsigned long) stale);
+}
+
+// raw readings end to end: the new table against colourClick_classify()
+static void reportSamples(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return;
+    }
+    unsigned c, r, g, b;
+    size_t n = 0, diff = 0;
+    while (fscanf(file, "%u %u %u %u", &c, &r, &g, &b) == 4) {
+        uint16_t raw[3] = {(uint16_t) r, (uint16_t) g, (uint16_t) b};
+        uint8_t rgb[3];
+        colourClick_calibrate(raw, rgb);
+        Card card = colourClick_classify(rgb, (uint16_t) c);
+        Card looked_up = lookup(rgb, (uint16_t) c);
+        if (looked_up != card) {
+            if (diff < 20) printf("  %u %u %u %u: classifier %s, table %s\n", c, r, g, b, CARD_NAMES[card], CARD_NAMES[looked_up]);
+            ++diff;
+        }
+        ++n;
+    }
+    fclose(file);
+    printf("%s: %zu of %zu samples differ\n", path, diff, n);
+}
+
+int main(int argc, char **argv) {
+    const char *samples = NULL, *out = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) samples = argv[++i];
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) out = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [-s samples.txt] [-o cardTable.c]\n", argv[0]);
+            return 2;
+        }
+    }
+    makeBins();
+    if (samples != NULL && !loadVotes(samples)) return 2;
+    generate();
+    report();
+    if (samples != NULL) reportSamples(samples);
+    if (out != NULL && !writeTable(out)) return 2;
+    free(codes);
+    free(votes);
+    return 0;
+}
@@ -0,0 +1,283 @@
+// Fits the card prototypes (CARD_H/CARD_S) and the white/black thresholds
+// (range_threshold, white_threshold) to labelled readings, reports how the
+// classifier does on them before and after, and writes cardPrototypes.h.
+//
+//   make -C host card_train && ./host/build/card_train samples.txt [-o cardPrototypes.h]
+//
+// A samples file has one labelled reading per line: "<card> <c> <r> <g> <b>",
+// with the card by name (RED, GREEN, ..., WHITE, BLACK) and the raw counts the
+// classifier sees, i.e. LED-on minus LED-off with __AMBIENT_FRAME. Lines
+// starting with # are skipped. Cards with no readings keep their linked
+// prototype. Regenerate cardTable.c (make -C host card_table) after installing
+// a new header.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "../colourClick.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#define NUM_CODES CLEAR // every card a reading can be labelled with
+
+extern uint16_t CARD_H[];
+extern uint16_t CARD_S[];
+extern uint8_t range_threshold;
+extern uint16_t white_threshold;
+
+static const char *const CARD_NAMES[CLEAR + 1] = {"RED", "GREEN", "DBLUE", "YELLOW", "PINK", "ORANGE", "LBLUE", "WHITE", "BLACK", "CLEAR"};
+
+typedef struct {
+    Card label;
+    uint16_t c;
+    uint8_t rgb[3]; // white-calibrated
+} Reading;
+
+static Reading *readings;
+static size_t num_readings;
+
+static bool load(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    size_t cap = 1024, line_no = 0;
+    readings = malloc(cap * sizeof(Reading));
+    char line[128];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        ++line_no;
+        char name[16];
+        unsigned c, r, g, b;
+        if (line[0] == '#' || sscanf(line, "%15s", name) != 1) continue;
+        if (sscanf(line, "%15s %u %u %u %u", name, &c, &r, &g, &b) != 5) {
+            fprintf(stderr, "%s:%zu: expected \"<card> <c> <r> <g> <b>\"\n", path, line_no);
+            continue;
+        }
+        int8_t label = -1;
+        for (uint8_t i = 0; i < NUM_CODES; ++i) {
+            if (strcmp(name, CARD_NAMES[i]) == 0) label = (int8_t) i;
+        }
+        if (label < 0) {
+            fprintf(stderr, "%s:%zu: unknown card %s\n", path, line_no, name);
+            continue;
+        }
+        if (num_readings == cap) readings = realloc(readings, (cap *= 2) * sizeof(Reading));
+        Reading *reading = &readings[num_readings++];
+        uint16_t raw[3] = {(uint16_t) r, (uint16_t) g, (uint16_t) b};
+        reading->label = (Card) label;
+        reading->c = (uint16_t) c;
+        colourClick_calibrate(raw, reading->rgb);
+    }
+    fclose(file);
+    printf("%s: %zu labelled readings\n", path, num_readings);
+    return num_readings > 0;
+}
+
+static inline uint8_t range(const uint8_t *rgb) {
+    uint8_t hi = rgb[0], lo = rgb[0];
+    for (uint8_t i = 1; i < 3; ++i) {
+        if (rgb[i] > hi) hi = rgb[i];
+        if (rgb[i] < lo) lo = rgb[i];
+    }
+    return hi - lo;
+}
+
+// -------------------- START FITTING --------------------
+
+// The threshold t in 0..size that best separates values below it (lo) from
+// values at or above it (hi): fewest misplaced values, then the middle of the
+// widest run of such thresholds for the most margin either side.
+static uint32_t split(const uint32_t *lo, const uint32_t *hi, uint32_t size, uint32_t *errors) {
+    uint32_t num_lo = 0;
+    for (uint32_t v = 0; v < size; ++v) num_lo += lo[v];
+    uint32_t lo_below = 0, hi_below = 0;
+    uint32_t best = UINT32_MAX, best_start = 0, best_len = 0, run_start = 0, run_len = 0;
+    for (uint32_t t = 0; t <= size; ++t) {
+        uint32_t e = (num_lo - lo_below) + hi_below;
+        if (e < best) {
+            best = e;
+            best_start = t;
+            best_len = 1;
+            run_len = 0;
+        }
+        if (e == best) {
+            if (run_len == 0) run_start = t;
+            if (++run_len > best_len) {
+                best_start = run_start;
+                best_len = run_len;
+            }
+        } else {
+            run_len = 0;
+        }
+        if (t < size) {
+            lo_below += lo[t];
+            hi_below += hi[t];
+        }
+    }
+    *errors = best;
+    return best_start + (best_len - 1) / 2;
+}
+
+// mean hue on the circle and mean saturation of each coloured card's readings
+static void fitPrototypes(void) {
+    double sin_sum[NUM_CARDS] = {0}, cos_sum[NUM_CARDS] = {0}, s_sum[NUM_CARDS] = {0};
+    uint32_t count[NUM_CARDS] = {0};
+    for (size_t i = 0; i < num_readings; ++i) {
+        Card label = readings[i].label;
+        if (label >= NUM_CARDS) continue;
+        const HSLColour *hsl = rgb2hsl(readings[i].rgb[0], readings[i].rgb[1], readings[i].rgb[2]);
+        sin_sum[label] += sin(hsl->h * M_PI / 180);
+        cos_sum[label] += cos(hsl->h * M_PI / 180);
+        s_sum[label] += hsl->s;
+        ++count[label];
+    }
+    for (uint8_t card = 0; card < NUM_CARDS; ++card) {
+        if (count[card] == 0) {
+            printf("  %-7s no readings, kept %u, %u\n", CARD_NAMES[card], CARD_H[card], CARD_S[card]);
+            continue;
+        }
+        double h = atan2(sin_sum[card], cos_sum[card]) * 180 / M_PI;
+        uint16_t hue = (uint16_t) lround(h < 0 ? h + 360 : h) % 360;
+        uint16_t sat = (uint16_t) lround(s_sum[card] / count[card]);
+        printf("  %-7s h %3u -> %3u, s %3u -> %3u (%lu readings)\n", CARD_NAMES[card], CARD_H[card], hue, CARD_S[card], sat,
+                (unsigned long) count[card]);
+        CARD_H[card] = hue;
+        CARD_S[card] = sat;
+    }
+}
+
+// achromatic readings have an RGB range below range_threshold, coloured ones at or above it
+static void fitRangeThreshold(void) {
+    uint32_t achromatic[256] = {0}, coloured[256] = {0};
+    size_t num_achromatic = 0;
+    for (size_t i = 0; i < num_readings; ++i) {
+        bool is_achromatic = readings[i].label >= NUM_CARDS;
+        ++(is_achromatic ? achromatic : coloured)[range(readings[i].rgb)];
+        num_achromatic += is_achromatic;
+    }
+    if (num_achromatic == 0 || num_achromatic == num_readings) {
+        printf("  range_threshold needs white/black and coloured readings, kept %u\n", range_threshold);
+        return;
+    }
+    uint32_t errors;
+    uint32_t t = split(achromatic, coloured, 256, &errors);
+    uint8_t fitted = t > 255 ? 255 : t < 1 ? 1 : (uint8_t) t; // colourClick_confidence() divides by it
+    printf("  range_threshold %u -> %u (%lu readings on the wrong side)\n", range_threshold, fitted, (unsigned long) errors);
+    range_threshold = fitted;
+}
+
+// black is at or below white_threshold on the LED-on clear channel, white above
+static void fitWhiteThreshold(void) {
+    static uint32_t black[65536], white[65536];
+    size_t num_black = 0, num_white = 0;
+    for (size_t i = 0; i < num_readings; ++i) {
+        if (readings[i].label == BLACK) {
+            ++black[readings[i].c];
+            ++num_black;
+        } else if (readings[i].label == WHITE) {
+            ++white[readings[i].c];
+            ++num_white;
+        }
+    }
+    if (num_black == 0 || num_white == 0) {
+        printf("  white_threshold needs white and black readings, kept %u\n", white_threshold);
+        return;
+    }
+    uint32_t errors;
+    uint32_t t = split(black, white, 65536, &errors); // black below t, so white_threshold is t - 1
+    uint16_t fitted = t <= 1 ? 1 : (uint16_t) (t - 1); // colourClick_confidence() divides by it
+    printf("  white_threshold %u -> %u (%lu readings on the wrong side)\n", white_threshold, fitted, (unsigned long) errors);
+    white_threshold = fitted;
+}
+
+// -------------------- END FITTING --------------------
+
+// confusion matrix of colourClick_classify() over the readings, and each card's worst margin
+static void evaluate(const char *name) {
+    uint32_t confusion[NUM_CODES][NUM_CODES] = {{0}};
+    uint32_t labelled[NUM_CODES] = {0};
+    uint8_t worst[NUM_CODES];
+    size_t worst_idx[NUM_CODES];
+    memset(worst, 101, sizeof(worst));
+    size_t correct = 0, unsure = 0;
+    for (size_t i = 0; i < num_readings; ++i) {
+        const Reading *reading = &readings[i];
+        Card card = colourClick_classify(reading->rgb, reading->c);
+        ++confusion[reading->label][card];
+        ++labelled[reading->label];
+        if (card == reading->label) ++correct;
+        uint8_t confidence = card == reading->label ? colourClick_confidence(reading->rgb, reading->c) : 0; // a misread has no margin
+        if (confidence < CARD_CONFIDENCE) ++unsure;
+        if (confidence < worst[reading->label]) {
+            worst[reading->label] = confidence;
+            worst_idx[reading->label] = i;
+        }
+    }
+
+    printf("%s: %zu of %zu correct (%.1f%%), %zu below CARD_CONFIDENCE\n", name, correct, num_readings,
+            100.0 * correct / num_readings, unsure);
+    printf("  %-7s", "");
+    for (uint8_t j = 0; j < NUM_CODES; ++j) printf(" %6.6s", CARD_NAMES[j]);
+    printf("  margin (worst reading)\n");
+    for (uint8_t i = 0; i < NUM_CODES; ++i) {
+        if (labelled[i] == 0) continue;
+        printf("  %-7s", CARD_NAMES[i]);
+        for (uint8_t j = 0; j < NUM_CODES; ++j) printf(" %6lu", (unsigned long) confusion[i][j]);
+        const Reading *reading = &readings[worst_idx[i]];
+        printf("  %3u (c %u, rgb %u %u %u)\n", worst[i], reading->c, reading->rgb[0], reading->rgb[1], reading->rgb[2]);
+    }
+}
+
+static bool writeHeader(const char *path, const char *samples) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    fprintf(file, "// Generated by host/card_train from %s, do not edit. Regenerate\n", samples);
+    fprintf(file, "// cardTable.c (make -C host card_table) after replacing this file.\n\n");
+    fprintf(file, "#ifndef CARD_PROTOTYPES_H\n#define CARD_PROTOTYPES_H\n\n");
+    fprintf(file, "// RED, GREEN, DBLUE, YELLOW, PINK, ORANGE, LBLUE\n");
+    fprintf(file, "#define CARD_H_PROTOTYPES {");
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) fprintf(file, i ? ", %3u" : "%3u", CARD_H[i]);
+    fprintf(file, "} // hue, degrees\n#define CARD_S_PROTOTYPES {");
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) fprintf(file, i ? ", %3u" : "%3u", CARD_S[i]);
+    fprintf(file, "} // saturation, percent\n\n");
+    fprintf(file, "#define RANGE_THRESHOLD %u\n", range_threshold);
+    fprintf(file, "#define WHITE_THRESHOLD %u\n\n", white_threshold);
+    fprintf(file, "#endif\n");
+    fclose(file);
+    printf("wrote %s\n", path);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *samples = NULL, *out = NULL;
+    bool usage = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) out = argv[++i];
+        else if (samples == NULL && argv[i][0] != '-') samples = argv[i];
+        else usage = true;
+    }
+    if (usage || samples == NULL) {
+        fprintf(stderr, "usage: %s samples.txt [-o cardPrototypes.h]\n", argv[0]);
+        return 2;
+    }
+    if (!load(samples)) return 2;
+
+    evaluate("linked");
+    printf("fit:\n");
+    fitPrototypes();
+    fitRangeThreshold();
+    fitWhiteThreshold();
+    evaluate("fitted");
+
+    if (out != NULL && !writeHeader(out, samples)) return 2;
+    free(readings);
+    return 0;
+}
@@ -0,0 +1,229 @@
+// Compares the integer colour pipeline (colourClick_calibrate() and
+// colourClick_classify(), or colourClick_lookup()) with the float pipeline it
+// replaced, on a sweep of raw sensor readings and optionally on recorded
+// samples, and times them.
+//
+//   make -C host colour_bench && ./host/build/colour_bench [samples.txt]
+//
+// A samples file has one raw LED-on reading per line: "<c> <r> <g> <b>".
+// Host timings only show the relative cost; PIC18 cycle and flash figures
+// come from the XC8 map file and simulator.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../colourClick.h"
+
+#define SWEEP_STEP 1021 // raw counts between sweep points, prime to avoid aligning with the scalers
+
+extern uint16_t CARD_H[];
+extern uint16_t CARD_S[];
+extern uint8_t range_threshold;
+extern uint16_t white_threshold;
+
+typedef struct {
+    uint16_t c, r, g, b;
+} Sample;
+
+// -------------------- START FLOAT REFERENCE --------------------
+
+static const float REF_SCALER[3] = {1, 1.327, 1.897};
+
+static inline float fmaxf3(float a, float b, float c) {
+    float m = a > b ? a : b;
+    return m > c ? m : c;
+}
+
+static inline float fminf3(float a, float b, float c) {
+    float m = a < b ? a : b;
+    return m < c ? m : c;
+}
+
+static HSLColour refRgb2hsl(uint8_t R, uint8_t G, uint8_t B) {
+    float r = (float) R / 255;
+    float g = (float) G / 255;
+    float b = (float) B / 255;
+    float M = fmaxf3(r, g, b);
+    float m = fminf3(r, g, b);
+    float c = M - m;
+    float h, s, l;
+    if (c < 1e-10) {
+        h = 0;
+    } else {
+        float segment = 0;
+        float shift = 0;
+        if (M == r) {
+            segment = (g - b) / c;
+            if (segment < 0) shift = 6;
+        } else if (M == g) {
+            segment = (b - r) / c;
+            shift = 2;
+        } else {
+            segment = (r - g) / c;
+            shift = 4;
+        }
+        h = segment + shift;
+    }
+    l = (M + m) / 2;
+    if (l == 0 || l == 1) {
+        s = 0;
+    } else {
+        float temp = (2 * l - 1);
+        s = c / (1 - (temp < 0 ? -temp : temp));
+    }
+    return (HSLColour) {.h = (uint16_t) (h * 60), .s = (uint8_t) (s * 100), .l = (uint8_t) (l * 100)};
+}
+
+static void refCalibrate(const uint16_t raw[3], uint8_t rgb[3]) {
+    for (uint8_t i = 0; i < 3; ++i) {
+        uint16_t value = (uint16_t) ((float) raw[i] * REF_SCALER[i] / 256);
+        rgb[i] = value < 256 ? (uint8_t) value : 255;
+    }
+}
+
+static int16_t ab(int16_t a) {
+    return a < 0 ? -a : a;
+}
+
+static Card refClassify(const uint8_t rgb[3], uint16_t c) {
+    uint8_t lo = rgb[0], hi = rgb[0];
+    for (uint8_t i = 1; i < 3; ++i) {
+        if (rgb[i] < lo) lo = rgb[i];
+        if (rgb[i] > hi) hi = rgb[i];
+    }
+    if (hi - lo < range_threshold) return c > white_threshold ? WHITE : BLACK;
+    HSLColour hsl = refRgb2hsl(rgb[0], rgb[1], rgb[2]);
+    uint32_t smallest = (uint32_t) 1 << 31;
+    Card card = RED;
+    for (uint8_t i = 0; i < NUM_CARDS; ++i) {
+        int16_t h_dist = 180 - ab(ab((int16_t) CARD_H[i] - (int16_t) hsl.h) - 180);
+        int16_t s_dist = (int16_t) (CARD_S[i] - hsl.s);
+        uint32_t dist = (uint32_t) (h_dist * h_dist + s_dist * s_dist);
+        if (dist < smallest) {
+            smallest = dist;
+            card = (Card) i;
+        }
+    }
+    return card;
+}
+
+// -------------------- END FLOAT REFERENCE --------------------
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static Sample *sweep(size_t *num) {
+    size_t per_axis = 65535 / SWEEP_STEP + 1;
+    Sample *samples = malloc(per_axis * per_axis * per_axis * sizeof(Sample));
+    size_t n = 0;
+    for (uint32_t r = 0; r <= 65535; r += SWEEP_STEP) {
+        for (uint32_t g = 0; g <= 65535; g += SWEEP_STEP) {
+            for (uint32_t b = 0; b <= 65535; b += SWEEP_STEP) {
+                uint32_t c = r + g + b;
+                samples[n++] = (Sample) {(uint16_t) (c > 65535 ? 65535 : c), (uint16_t) r, (uint16_t) g, (uint16_t) b};
+            }
+        }
+    }
+    *num = n;
+    return samples;
+}
+
+static Sample *load(const char *path, size_t *num) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        exit(2);
+    }
+    size_t cap = 1024, n = 0;
+    Sample *samples = malloc(cap * sizeof(Sample));
+    unsigned c, r, g, b;
+    while (fscanf(file, "%u %u %u %u", &c, &r, &g, &b) == 4) {
+        if (n == cap) samples = realloc(samples, (cap *= 2) * sizeof(Sample));
+        samples[n++] = (Sample) {(uint16_t) c, (uint16_t) r, (uint16_t) g, (uint16_t) b};
+    }
+    fclose(file);
+    *num = n;
+    return samples;
+}
+
+static void compare(const char *name, const Sample *samples, size_t num) {
+    size_t rgb_diff = 0, hsl_diff = 0, classify_diff = 0, card_diff = 0, table_diff = 0, unsure = 0, unsure_diff = 0;
+    for (size_t i = 0; i < num; ++i) {
+        uint16_t raw[3] = {samples[i].r, samples[i].g, samples[i].b};
+        uint8_t ref_rgb[3], rgb[3];
+        refCalibrate(raw, ref_rgb);
+        colourClick_calibrate(raw, rgb);
+        if (ref_rgb[0] != rgb[0] || ref_rgb[1] != rgb[1] || ref_rgb[2] != rgb[2]) ++rgb_diff;
+
+        HSLColour ref_hsl = refRgb2hsl(rgb[0], rgb[1], rgb[2]);
+        const HSLColour *hsl = rgb2hsl(rgb[0], rgb[1], rgb[2]);
+        if (ref_hsl.h != hsl->h || ref_hsl.s != hsl->s || ref_hsl.l != hsl->l) ++hsl_diff;
+
+        Card ref_card = refClassify(ref_rgb, samples[i].c);
+        if (ref_card != colourClick_classify(ref_rgb, samples[i].c)) ++classify_diff;
+        if (ref_card != colourClick_classify(rgb, samples[i].c)) ++card_diff;
+        bool table_differs = ref_card != colourClick_lookup(rgb, samples[i].c);
+        if (table_differs) ++table_diff;
+        if (colourClick_confidence(rgb, samples[i].c) < CARD_CONFIDENCE) {
+            ++unsure;
+            if (table_differs) ++unsure_diff;
+        }
+    }
+    printf("%s: %zu samples\n", name, num);
+    printf("  calibrated RGB differs: %zu\n", rgb_diff);
+    printf("  HSL differs:            %zu (same calibrated RGB into both)\n", hsl_diff);
+    printf("  card differs:           %zu (same calibrated RGB into both)\n", classify_diff);
+    printf("  card differs:           %zu (end to end)\n", card_diff);
+    printf("  table card differs:     %zu (end to end, cardTable.c)\n", table_diff);
+    printf("  below CARD_CONFIDENCE:  %zu (%.1f%%), %zu of the table differences\n", unsure, 100.0 * unsure / num, unsure_diff);
+}
+
+static void timePipelines(const Sample *samples, size_t num) {
+    volatile uint32_t sink = 0;
+    double start = now_ns();
+    for (size_t i = 0; i < num; ++i) {
+        uint16_t raw[3] = {samples[i].r, samples[i].g, samples[i].b};
+        uint8_t rgb[3];
+        refCalibrate(raw, rgb);
+        sink += refClassify(rgb, samples[i].c);
+    }
+    double ref_ns = (now_ns() - start) / (double) num;
+    start = now_ns();
+    for (size_t i = 0; i < num; ++i) {
+        uint16_t raw[3] = {samples[i].r, samples[i].g, samples[i].b};
+        uint8_t rgb[3];
+        colourClick_calibrate(raw, rgb);
+        sink += colourClick_classify(rgb, samples[i].c);
+    }
+    double int_ns = (now_ns() - start) / (double) num;
+    start = now_ns();
+    for (size_t i = 0; i < num; ++i) {
+        uint16_t raw[3] = {samples[i].r, samples[i].g, samples[i].b};
+        uint8_t rgb[3];
+        colourClick_calibrate(raw, rgb);
+        sink += colourClick_lookup(rgb, samples[i].c);
+    }
+    double table_ns = (now_ns() - start) / (double) num;
+    printf("calibrate + classify: float %.1f ns, integer %.1f ns (host, %.2fx)\n", ref_ns, int_ns, ref_ns / int_ns);
+    printf("calibrate + lookup:   %.1f ns (host, %.2fx over float)\n", table_ns, ref_ns / table_ns);
+}
+
+int main(int argc, char **argv) {
+    size_t num;
+    Sample *samples = sweep(&num);
+    compare("sweep", samples, num);
+    timePipelines(samples, num);
+    free(samples);
+
+    if (argc > 1) {
+        samples = load(argv[1], &num);
+        compare(argv[1], samples, num);
+        free(samples);
+    }
+    return 0;
+}
@@ -0,0 +1,151 @@
+// Drives colourClick_calibrateAll() from scripted RF2/RF3 presses against the
+// ColourClick model, with a card, the wall or open space in front of the
+// sensor at each press, and checks what it learns: the white balance, a
+// prototype from its reading, skipped cards kept, white_threshold from white
+// and black (a black reading of 0 included, and never below 1) and
+// clear_threshold, and that the result is saved.
+//
+//   make -C host colour_learn && ./host/build/colour_learn
+//
+// Exits non-zero if any check fails.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_linux.h"
+#include "colourclick_model.h"
+#include "../colourClick.h"
+#include "../buttons.h"
+
+extern uint16_t rgb_scaler[];
+extern uint16_t clear_threshold;
+extern uint16_t white_threshold;
+extern uint16_t CARD_H[];
+extern uint16_t CARD_S[];
+
+typedef enum { DARK, WALL, OPEN, WHITE_CARD, RED_CARD } Scene;
+
+// C, R, G, B above the ambient with the LED on, at ATIME 0xC0 and 4x gain
+static const uint16_t LIT[][MODEL_NUM_CHANNELS] = {
+    [DARK] = {0, 0, 0, 0}, // also black: nothing above the ambient
+    [WALL] = {0, 0, 0, 0},
+    [OPEN] = {0, 0, 0, 0},
+    [WHITE_CARD] = {57000, 25000, 19000, 13000},
+    [RED_CARD] = {22000, 15000, 4000, 3000},
+};
+static const uint16_t AMBIENT[MODEL_NUM_CHANNELS] = {40, 10, 10, 10}; // under the shroud, LED off
+#define OPEN_C 2000 // LED off, nothing in front
+
+typedef struct {
+    ButtonsState button;
+    Scene scene; // in front of the sensor from this press on
+} Press;
+
+static const Press *script;
+static uint8_t num_presses;
+static uint8_t next;
+static Scene scene;
+static bool failed;
+
+static void check(bool ok, const char *what) {
+    printf("%s  %s\n", ok ? "ok  " : "FAIL", what);
+    if (!ok) failed = true;
+}
+
+static void source(uint8_t led, uint16_t rgbc[MODEL_NUM_CHANNELS]) {
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) {
+        rgbc[i] = scene == OPEN ? (i == MODEL_C ? OPEN_C : OPEN_C / 3) : AMBIENT[i];
+        if (led != 0) rgbc[i] += LIT[scene][i];
+    }
+}
+
+// each scripted press reads as down once, then both buttons read up for the
+// release before the next press
+static bool isDown(ButtonsState button) {
+    static uint32_t idle_reads;
+    static uint8_t release_reads;
+    if (release_reads != 0) {
+        --release_reads;
+        return false;
+    }
+    if (next == num_presses) {
+        if (++idle_reads < 1000) return false; // the release after the last press
+        check(false, "calibration asks for no more presses than scripted");
+        exit(1);
+    }
+    idle_reads = 0;
+    if (script[next].button != button) return false;
+    scene = script[next++].scene;
+    release_reads = 2; // RF2 and RF3 in buttons_waitForRelease()
+    return true;
+}
+
+static bool readRF2(void) {
+    return !isDown(RF2_DOWN); // active LOW
+}
+
+static bool readRF3(void) {
+    return !isDown(RF3_DOWN);
+}
+
+static void run(const Press *presses, uint8_t count) {
+    script = presses;
+    num_presses = count;
+    next = 0;
+    scene = DARK;
+    colourClick_calibrateAll();
+    check(next == num_presses, "every scripted press was used");
+}
+
+// white balance, RED learned, the other colours skipped, then white, a black that reads 0, the wall and open space
+static void learn(void) {
+    static const Press PRESSES[] = {
+        {RF2_DOWN, WHITE_CARD}, {RF3_DOWN, DARK}, // white balance, done
+        {RF2_DOWN, RED_CARD}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK},
+        {RF2_DOWN, WHITE_CARD}, {RF2_DOWN, DARK}, // WHITE, BLACK
+        {RF2_DOWN, WALL}, {RF2_DOWN, OPEN},
+    };
+    uint16_t kept_h = CARD_H[GREEN], kept_s = CARD_S[GREEN];
+    uint32_t writes = hal_linux_eepromWrites();
+    run(PRESSES, sizeof(PRESSES) / sizeof(PRESSES[0]));
+
+    uint8_t white[3];
+    colourClick_calibrate(&LIT[WHITE_CARD][MODEL_R], white);
+    check(white[0] == white[1] && white[1] == white[2], "white balance makes the white card grey");
+    uint8_t red[3];
+    colourClick_calibrate(&LIT[RED_CARD][MODEL_R], red);
+    const HSLColour *hsl = rgb2hsl(red[0], red[1], red[2]);
+    printf("      RED learned h=%u s=%u\n", CARD_H[RED], CARD_S[RED]);
+    check(CARD_H[RED] == hsl->h && CARD_S[RED] == hsl->s, "RED prototype is its ambient-subtracted reading");
+    check(CARD_H[GREEN] == kept_h && CARD_S[GREEN] == kept_s, "a skipped card keeps its prototype");
+    check(white_threshold == LIT[WHITE_CARD][MODEL_C] / 2, "white_threshold between white and a black reading of 0");
+    check(clear_threshold == (AMBIENT[MODEL_C] + OPEN_C) / 2, "clear_threshold between the wall and open space");
+    check(hal_linux_eepromWrites() > writes, "calibration is saved");
+}
+
+// white and black both read 0: white_threshold stays a usable divisor
+static void zeroReadings(void) {
+    static const Press PRESSES[] = {
+        {RF3_DOWN, DARK}, // no white balance
+        {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK}, {RF3_DOWN, DARK},
+        {RF2_DOWN, DARK}, {RF2_DOWN, DARK}, // WHITE, BLACK
+        {RF3_DOWN, DARK}, // no wall
+    };
+    uint16_t scaler = rgb_scaler[0], clear = clear_threshold;
+    run(PRESSES, sizeof(PRESSES) / sizeof(PRESSES[0]));
+    check(white_threshold == 1, "white_threshold of 0 is raised to 1");
+    check(rgb_scaler[0] == scaler && clear_threshold == clear, "skipped steps keep their values");
+}
+
+int main(void) {
+    hal_linux_reset();
+    hal_linux_setUartSink(NULL);
+    colourClickModel_attach(source);
+    colourClick_init();
+    hal_linux_setPinReader(HAL_RF2_BUTTON, readRF2);
+    hal_linux_setPinReader(HAL_RF3_BUTTON, readRF3);
+    learn();
+    zeroReadings();
+    return failed ? 1 : 0;
+}
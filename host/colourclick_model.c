@@ -0,0 +1,195 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "colourclick_model.h"
+#include "hal_linux.h"
+
+#define ADDR 0x52
+
+#define NUM_REGISTERS 0x20
+#define R_ENABLE 0x00
+#define R_ATIME 0x01
+#define R_WTIME 0x03
+#define AILTL 0x04
+#define AIHTL 0x06
+#define R_APERS 0x0C
+#define R_CONFIG 0x0D
+#define R_CONTROL 0x0F
+#define R_STATUS 0x13
+#define CDATA 0x14
+#define BDATA 0x1A
+
+#define ENABLE_AEN 0x02
+#define ENABLE_WEN 0x08
+#define ENABLE_AIEN 0x10
+#define CONFIG_WLONG 0x02
+#define CONTROL_AGAIN 0x03
+#define STATUS_AINT 0x10
+#define STATUS_AVALID 0x01
+
+#define CMD_TYPE_AUTO_INCREMENT 0b01
+#define CMD_TYPE_SPECIAL 0b11
+#define SPECIAL_CLEAR_INT 0b00110
+
+#define STEP_US 2400 // ATIME step and start-up time
+
+// sources report counts at this configuration, the model scales them to the configured one
+#define REFERENCE_STEPS 64 // ATIME 0xC0
+#define REFERENCE_GAIN 4
+
+static const uint8_t GAIN[4] = {1, 4, 16, 60};
+
+static struct {
+    ColourClickSource source;
+    uint8_t registers[NUM_REGISTERS];
+    uint8_t pointer;
+    bool auto_increment;
+    bool expect_command;
+    uint32_t aen_ms; // when RGBC was last enabled
+    bool out_of_range; // clear channel outside the interrupt thresholds when INT was last read
+    uint32_t out_of_range_ms; // since when
+} model;
+
+static uint8_t ledBrightness(void) {
+    uint16_t sum = (uint16_t) hal_linux_ledLevel(HAL_CARD_R) + hal_linux_ledLevel(HAL_CARD_G) + hal_linux_ledLevel(HAL_CARD_B);
+    return (uint8_t) (sum / 3);
+}
+
+static uint32_t integrationSteps(void) {
+    return 256 - model.registers[R_ATIME];
+}
+
+// integration plus wait
+static uint32_t cycleUs(void) {
+    uint32_t wait_us = 0;
+    if (model.registers[R_ENABLE] & ENABLE_WEN) {
+        wait_us = (256 - model.registers[R_WTIME]) * STEP_US;
+        if (model.registers[R_CONFIG] & CONFIG_WLONG) wait_us *= 12;
+    }
+    return integrationSteps() * STEP_US + wait_us;
+}
+
+static void sample(uint16_t rgbc[MODEL_NUM_CHANNELS]) {
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) rgbc[i] = 0;
+    if (model.source == NULL) return;
+    model.source(ledBrightness(), rgbc);
+    uint32_t scale = integrationSteps() * GAIN[model.registers[R_CONTROL] & CONTROL_AGAIN];
+    uint32_t full_scale = integrationSteps() * 1024; // counts saturate at 1024 per step
+    if (full_scale > 65535) full_scale = 65535;
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) {
+        uint32_t value = rgbc[i] * scale / (REFERENCE_STEPS * REFERENCE_GAIN);
+        rgbc[i] = (uint16_t) (value > full_scale ? full_scale : value);
+    }
+}
+
+// consecutive out-of-range cycles before AINT is set
+static uint32_t persistence(void) {
+    uint8_t apers = model.registers[R_APERS] & 0x0f;
+    return apers <= 3 ? (apers == 0 ? 1 : apers) : 5 * (uint32_t) (apers - 3);
+}
+
+// latch a fresh RGBC sample into CDATA..BDATA
+static void latchData(void) {
+    uint16_t rgbc[MODEL_NUM_CHANNELS];
+    sample(rgbc);
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) {
+        model.registers[CDATA + 2 * i] = rgbc[i] & 0xff;
+        model.registers[CDATA + 2 * i + 1] = (rgbc[i] >> 8) & 0xff;
+    }
+}
+
+// the first integration completes start-up plus ATIME after AEN; data itself is sampled when read
+static void updateValid(void) {
+    uint32_t ready_us = STEP_US + (uint32_t) (256 - model.registers[R_ATIME]) * STEP_US;
+    bool valid = (model.registers[R_ENABLE] & ENABLE_AEN) && (hal_clock_ms() - model.aen_ms) * 1000 >= ready_us;
+    if (valid) model.registers[R_STATUS] |= STATUS_AVALID;
+    else model.registers[R_STATUS] &= (uint8_t) ~STATUS_AVALID;
+}
+
+static uint16_t readWord(uint8_t address) {
+    return model.registers[address] | (uint16_t) (model.registers[address + 1] << 8);
+}
+
+static void start(bool is_read) {
+    model.expect_command = !is_read;
+    if (is_read && model.pointer >= CDATA && model.pointer <= BDATA + 1) latchData(); // data is latched at the start of a read
+}
+
+static void write(uint8_t byte) {
+    if (model.expect_command) {
+        model.expect_command = false;
+        uint8_t type = (byte >> 5) & 0b11;
+        if (type == CMD_TYPE_SPECIAL) {
+            if ((byte & 0x1f) == SPECIAL_CLEAR_INT) model.registers[R_STATUS] &= (uint8_t) ~STATUS_AINT;
+            return;
+        }
+        model.auto_increment = type == CMD_TYPE_AUTO_INCREMENT;
+        model.pointer = byte & 0x1f;
+        return;
+    }
+    if (model.pointer == R_ENABLE && (byte & ENABLE_AEN) && !(model.registers[R_ENABLE] & ENABLE_AEN)) {
+        model.aen_ms = hal_clock_ms(); // restarts integration and the persistence count
+        model.out_of_range = false;
+    }
+    if (model.pointer != R_STATUS && model.pointer < CDATA) model.registers[model.pointer] = byte;
+    if (model.auto_increment) model.pointer = (model.pointer + 1) % NUM_REGISTERS;
+}
+
+static uint8_t read(bool ack) {
+    (void) ack;
+    if (model.pointer == R_STATUS) updateValid();
+    uint8_t value = model.registers[model.pointer];
+    if (model.auto_increment) model.pointer = (model.pointer + 1) % NUM_REGISTERS; // otherwise repeated byte protocol
+    return value;
+}
+
+static const HalLinuxI2CDevice device = {
+    .address = ADDR,
+    .start = start,
+    .write = write,
+    .read = read,
+    .stop = NULL,
+};
+
+void colourClickModel_attach(ColourClickSource source) {
+    for (uint8_t i = 0; i < NUM_REGISTERS; ++i) model.registers[i] = 0;
+    model.registers[R_ATIME] = 0xFF; // power-on defaults
+    model.registers[R_WTIME] = 0xFF;
+    model.registers[0x12] = 0x44; // ID: TCS34711/TCS34715
+    model.source = source;
+    model.pointer = 0;
+    model.auto_increment = false;
+    model.expect_command = false;
+    model.aen_ms = 0;
+    model.out_of_range = false;
+    hal_linux_attachI2C(&device);
+    hal_linux_setPinReader(HAL_COLOUR_INT, colourClickModel_readInt);
+}
+
+uint8_t colourClickModel_register(uint8_t address) {
+    return model.registers[address % NUM_REGISTERS];
+}
+
+// AINT is set at the end of the persistence-th cycle that completes after the
+// clear channel left the thresholds; the channel is only sampled when INT is
+// read, so it is taken to have stayed out of range in between
+bool colourClickModel_readInt(void) {
+    if ((model.registers[R_ENABLE] & (ENABLE_AIEN | ENABLE_AEN)) == (ENABLE_AIEN | ENABLE_AEN)) {
+        uint16_t rgbc[MODEL_NUM_CHANNELS];
+        sample(rgbc);
+        uint32_t now = hal_clock_ms();
+        if (rgbc[MODEL_C] >= readWord(AILTL) && rgbc[MODEL_C] <= readWord(AIHTL)) {
+            model.out_of_range = false;
+        } else if (!model.out_of_range) {
+            model.out_of_range = true;
+            model.out_of_range_ms = now;
+        }
+        if (model.out_of_range) {
+            uint64_t first_end_us = (uint64_t) model.aen_ms * 1000 + STEP_US + integrationSteps() * STEP_US;
+            uint64_t since_us = (uint64_t) model.out_of_range_ms * 1000;
+            uint64_t cycles_before = since_us < first_end_us ? 0 : (since_us - first_end_us) / cycleUs() + 1;
+            uint64_t set_us = first_end_us + (cycles_before + persistence() - 1) * cycleUs();
+            if ((uint64_t) now * 1000 >= set_us) model.registers[R_STATUS] |= STATUS_AINT;
+        }
+    }
+    return !(model.registers[R_STATUS] & STATUS_AINT);
+}
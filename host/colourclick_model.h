@@ -0,0 +1,23 @@
+#ifndef COLOURCLICK_MODEL_H
+#define	COLOURCLICK_MODEL_H
+
+// Register-level model of the ColourClick's TCS3471 colour sensor on the
+// host I2C bus (address 0x52). Channel values come from a source callback so
+// tools can feed fixed samples, recorded data or a simulated arena. Sources
+// give counts at ATIME 0xC0 and 4x gain; the model scales them to the
+// configured integration time and gain, and sets the interrupt only at the end
+// of an integration cycle, after the configured persistence.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum { MODEL_C, MODEL_R, MODEL_G, MODEL_B, MODEL_NUM_CHANNELS } ModelChannel;
+
+// fill rgbc with the sensor reading at the current time, led is the 0..255 LED brightness
+typedef void (*ColourClickSource)(uint8_t led, uint16_t rgbc[MODEL_NUM_CHANNELS]);
+
+void colourClickModel_attach(ColourClickSource source); // reset registers and attach to the I2C bus
+uint8_t colourClickModel_register(uint8_t address);
+bool colourClickModel_readInt(void); // INT pin level, active LOW; also how the model notices the clear channel leaving the thresholds
+
+#endif	/* COLOURCLICK_MODEL_H */
@@ -0,0 +1,421 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_linux.h"
+#include "../serial.h"
+#include "../colourClick.h"
+#include "../i2c.h"
+#include "../motors.h"
+
+typedef enum {
+    I2C_EVENT_NONE,
+    I2C_EVENT_START, // or repeated start
+    I2C_EVENT_STOP,
+    I2C_EVENT_WRITE,
+    I2C_EVENT_RECEIVE,
+    I2C_EVENT_ACK,
+} HalI2CEvent;
+
+static struct {
+    bool pins[HAL_NUM_PINS];
+    bool (*readers[HAL_NUM_PINS])(void);
+    uint8_t duties[HAL_NUM_PWM];
+    uint8_t pwm_period;
+    void (*pwm_hook)(HalPwmChannel channel, uint8_t duty);
+    uint32_t elapsed_ms;
+    bool deadline_armed;
+    bool led_timer_on;
+    const HalLinuxI2CDevice *i2c_device;
+    HalI2CEvent i2c_event; // started by the firmware, not yet completed
+    uint8_t i2c_byte; // written, or received
+    bool i2c_acked;
+    bool i2c_expect_address;
+    bool i2c_selected;
+    bool i2c_hung; // a slave holds the bus until hal_i2c_recover()
+    uint32_t i2c_bytes;
+    uint32_t i2c_recoveries;
+    uint32_t i2c_overruns;
+    FILE *uart_sink;
+    bool uart_tx_held; // the host tool drains TX itself
+} hal;
+
+#define EEPROM_WRITE_MS 4 // typical erase and write time
+
+// outlives hal_linux_reset(), which is a power cycle as far as the EEPROM is concerned
+static struct {
+    uint8_t bytes[HAL_EEPROM_SIZE];
+    FILE *file; // written through on every write; without one each reset starts erased
+    uint32_t writes;
+    uint32_t busy_until_ms; // the last write finishes
+} eeprom;
+
+static bool deliverI2C(void);
+static void loadEEPROM(void);
+
+void hal_linux_reset(void) {
+    for (uint8_t i = 0; i < HAL_NUM_PINS; ++i) {
+        hal.pins[i] = false;
+        hal.readers[i] = NULL;
+    }
+    hal.pins[HAL_RF2_BUTTON] = true; // buttons and interrupt are active LOW
+    hal.pins[HAL_RF3_BUTTON] = true;
+    hal.pins[HAL_COLOUR_INT] = true;
+    for (uint8_t i = 0; i < HAL_NUM_PWM; ++i) hal.duties[i] = 0;
+    hal.pwm_period = 0;
+    hal.pwm_hook = NULL;
+    hal.elapsed_ms = 0;
+    hal.deadline_armed = false;
+    hal.led_timer_on = false;
+    hal.i2c_device = NULL;
+    hal.i2c_event = I2C_EVENT_NONE;
+    hal.i2c_expect_address = false;
+    hal.i2c_selected = false;
+    hal.i2c_hung = false;
+    hal.i2c_bytes = 0;
+    hal.i2c_recoveries = 0;
+    hal.i2c_overruns = 0;
+    hal.uart_sink = NULL;
+    hal.uart_tx_held = false;
+    loadEEPROM();
+}
+
+// -------------------- START GPIO --------------------
+
+void hal_gpio_setOutput(HalPin pin) {
+    (void) pin;
+}
+
+void hal_gpio_setInput(HalPin pin) {
+    (void) pin;
+}
+
+void hal_gpio_write(HalPin pin, bool value) {
+    hal.pins[pin] = value;
+}
+
+void hal_gpio_toggle(HalPin pin) {
+    hal.pins[pin] = !hal.pins[pin];
+}
+
+bool hal_gpio_read(HalPin pin) {
+    if (hal.readers[pin] != NULL) return hal.readers[pin]();
+    return hal.pins[pin];
+}
+
+void hal_linux_setPin(HalPin pin, bool value) {
+    hal.pins[pin] = value;
+}
+
+void hal_linux_setPinReader(HalPin pin, bool (*reader)(void)) {
+    hal.readers[pin] = reader;
+}
+
+uint8_t hal_linux_ledLevel(HalPin pin) {
+    #ifdef __CARD_LED
+    if (hal.led_timer_on && (pin == HAL_CARD_R || pin == HAL_CARD_G || pin == HAL_CARD_B)) {
+        // run one full period of the TMR2 software PWM interrupt and count the on-time
+        uint8_t on = 0;
+        for (uint16_t i = 0; i < 256; ++i) {
+            colourClick_interruptLED();
+            if (hal.pins[pin] && on < 255) ++on;
+        }
+        return on;
+    }
+    #endif
+    return hal.pins[pin] ? 255 : 0;
+}
+
+// -------------------- END GPIO --------------------
+// -------------------- START PWM --------------------
+
+void hal_pwm_init(uint8_t period) {
+    hal.pwm_period = period;
+    for (uint8_t i = 0; i < HAL_NUM_PWM; ++i) hal.duties[i] = 0;
+}
+
+void hal_pwm_setDuty(HalPwmChannel channel, uint8_t duty) {
+    if (hal.duties[channel] == duty) return;
+    if (hal.pwm_hook != NULL) hal.pwm_hook(channel, duty);
+    hal.duties[channel] = duty;
+}
+
+uint8_t hal_linux_pwmDuty(HalPwmChannel channel) {
+    return hal.duties[channel];
+}
+
+uint8_t hal_linux_pwmPeriod(void) {
+    return hal.pwm_period;
+}
+
+void hal_linux_setPwmHook(void (*hook)(HalPwmChannel channel, uint8_t duty)) {
+    hal.pwm_hook = hook;
+}
+
+// -------------------- END PWM --------------------
+// -------------------- START CLOCK --------------------
+
+void hal_clock_init(void) {
+    // the virtual clock runs on across a firmware restart, only hal_linux_reset() rewinds it
+}
+
+void hal_clock_tick(void) {
+    ++hal.elapsed_ms;
+}
+
+uint32_t hal_clock_ms(void) {
+    return hal.elapsed_ms;
+}
+
+uint16_t hal_clock_phaseUs(void) {
+    return 0; // interrupts run on the tick, without latency
+}
+
+void hal_delay_ms(uint16_t ms) {
+    hal_linux_advanceClock(ms); // nothing to wait for, skip straight to the deadline
+}
+
+// the tick interrupt, one ms at a time only while something runs off it
+void hal_linux_advanceClock(uint32_t ms) {
+    for (uint32_t i = 0; i < ms && I2C2_isBusy(); ++i) { // the bus runs meanwhile, far faster than the tick
+        while (deliverI2C()) {}
+        I2C2_tick();
+    }
+    if (!motors_isBusy() && !hal.deadline_armed) {
+        hal.elapsed_ms += ms;
+        return;
+    }
+    for (uint32_t i = 0; i < ms; ++i) {
+        hal_clock_tick();
+        if (hal.deadline_armed) { // the high-priority interrupt comes first
+            hal.deadline_armed = false;
+            motors_deadline();
+        }
+        motors_tick();
+    }
+}
+
+#ifdef __CARD_LED
+void hal_ledTimer_init(void) {
+    hal.led_timer_on = true;
+}
+#endif
+
+// -------------------- END CLOCK --------------------
+// -------------------- START DEADLINE --------------------
+
+void hal_deadline_arm(void) {
+    hal.deadline_armed = true;
+}
+
+void hal_deadline_cancel(void) {
+    hal.deadline_armed = false;
+}
+
+// -------------------- END DEADLINE --------------------
+// -------------------- START I2C --------------------
+
+// MSSP mock: each hal_i2c_*() call leaves one event pending, and the event
+// runs against the attached device when the firmware waits for it (or time
+// passes), then raises the interrupt like SSP2IF would.
+static bool deliverI2C(void) {
+    if (hal.i2c_event == I2C_EVENT_NONE || hal.i2c_hung) return false;
+    switch (hal.i2c_event) {
+        case I2C_EVENT_START:
+            hal.i2c_expect_address = true;
+            break;
+        case I2C_EVENT_STOP:
+            if (hal.i2c_selected && hal.i2c_device->stop != NULL) hal.i2c_device->stop();
+            hal.i2c_selected = false;
+            hal.i2c_expect_address = false;
+            break;
+        case I2C_EVENT_WRITE:
+            ++hal.i2c_bytes;
+            if (hal.i2c_expect_address) {
+                hal.i2c_expect_address = false;
+                hal.i2c_selected = hal.i2c_device != NULL && (hal.i2c_byte & 0xFE) == hal.i2c_device->address;
+                if (hal.i2c_selected && hal.i2c_device->start != NULL) hal.i2c_device->start(hal.i2c_byte & 0x01);
+            } else if (hal.i2c_selected && hal.i2c_device->write != NULL) {
+                hal.i2c_device->write(hal.i2c_byte);
+            }
+            hal.i2c_acked = hal.i2c_selected; // nobody drives ACK otherwise
+            break;
+        case I2C_EVENT_RECEIVE:
+            ++hal.i2c_bytes;
+            if (hal.i2c_selected && hal.i2c_device->read != NULL) hal.i2c_byte = hal.i2c_device->read(true);
+            else hal.i2c_byte = 0xFF; // bus pulled high
+            break;
+        default: // ACK
+            break;
+    }
+    hal.i2c_event = I2C_EVENT_NONE;
+    I2C2_interrupt();
+    return true;
+}
+
+static void queueI2C(HalI2CEvent event) {
+    if (hal.i2c_event != I2C_EVENT_NONE) ++hal.i2c_overruns; // the MSSP would set WCOL
+    hal.i2c_event = event;
+}
+
+void hal_linux_attachI2C(const HalLinuxI2CDevice *device) {
+    hal.i2c_device = device;
+}
+
+uint32_t hal_linux_i2cBytes(void) {
+    return hal.i2c_bytes;
+}
+
+void hal_linux_hangI2C(void) {
+    hal.i2c_hung = true;
+}
+
+uint32_t hal_linux_i2cRecoveries(void) {
+    return hal.i2c_recoveries;
+}
+
+uint32_t hal_linux_i2cOverruns(void) {
+    return hal.i2c_overruns;
+}
+
+void hal_i2c_init(void) {
+    hal.i2c_event = I2C_EVENT_NONE;
+    hal.i2c_expect_address = false;
+    hal.i2c_selected = false;
+}
+
+void hal_i2c_start(void) {
+    queueI2C(I2C_EVENT_START);
+}
+
+void hal_i2c_repeatStart(void) {
+    queueI2C(I2C_EVENT_START);
+}
+
+void hal_i2c_stop(void) {
+    queueI2C(I2C_EVENT_STOP);
+}
+
+void hal_i2c_write(uint8_t byte) {
+    hal.i2c_byte = byte;
+    queueI2C(I2C_EVENT_WRITE);
+}
+
+bool hal_i2c_acked(void) {
+    return hal.i2c_acked;
+}
+
+void hal_i2c_receive(void) {
+    queueI2C(I2C_EVENT_RECEIVE);
+}
+
+uint8_t hal_i2c_read(void) {
+    return hal.i2c_byte;
+}
+
+void hal_i2c_ack(bool ack) {
+    (void) ack; // the device model doesn't look at it
+    queueI2C(I2C_EVENT_ACK);
+}
+
+void hal_i2c_recover(void) {
+    ++hal.i2c_recoveries;
+    hal.i2c_hung = false;
+    if (hal.i2c_selected && hal.i2c_device->stop != NULL) hal.i2c_device->stop();
+    hal_i2c_init();
+}
+
+// -------------------- END I2C --------------------
+// -------------------- START INTERRUPTS --------------------
+
+bool hal_irq_disable(void) {
+    return true; // interrupts only run inside the HAL calls below
+}
+
+void hal_irq_restore(bool enabled) {
+    (void) enabled;
+}
+
+void hal_waitForInterrupt(void) {
+    if (!deliverI2C()) hal_linux_advanceClock(1); // nothing on the bus can finish, let the tick run
+}
+
+// -------------------- END INTERRUPTS --------------------
+// -------------------- START UART --------------------
+
+void hal_uart_init(void) {
+}
+
+void hal_uart_kickTX(void) {
+    // stands in for the TX4IF interrupt, which empties the buffer byte by byte
+    if (hal.uart_tx_held) return;
+    bool is_empty;
+    char ch;
+    while (ch = _EUSART4_readCharFromTX(&is_empty), !is_empty) {
+        if (hal.uart_sink != NULL) fputc(ch, hal.uart_sink);
+    }
+}
+
+void hal_linux_setUartSink(FILE *sink) {
+    hal.uart_sink = sink;
+}
+
+void hal_linux_holdUartTX(bool hold) {
+    hal.uart_tx_held = hold;
+}
+
+void hal_linux_uartReceive(char ch) {
+    _EUSART4_putCharInRX(ch);
+}
+
+// -------------------- END UART --------------------
+// -------------------- START EEPROM --------------------
+
+static void loadEEPROM(void) {
+    memset(eeprom.bytes, 0xff, sizeof(eeprom.bytes));
+    eeprom.writes = 0;
+    eeprom.busy_until_ms = 0;
+    if (eeprom.file == NULL) return;
+    rewind(eeprom.file);
+    if (fread(eeprom.bytes, 1, sizeof(eeprom.bytes), eeprom.file) < sizeof(eeprom.bytes)) clearerr(eeprom.file); // a short file is erased past its end
+}
+
+static void waitEEPROM(void) {
+    uint32_t now = hal_clock_ms();
+    if (now < eeprom.busy_until_ms) hal_linux_advanceClock(eeprom.busy_until_ms - now);
+}
+
+uint8_t hal_eeprom_read(uint16_t address) {
+    waitEEPROM();
+    return eeprom.bytes[address % HAL_EEPROM_SIZE];
+}
+
+void hal_eeprom_write(uint16_t address, uint8_t value) {
+    waitEEPROM();
+    address %= HAL_EEPROM_SIZE;
+    eeprom.bytes[address] = value;
+    ++eeprom.writes;
+    if (eeprom.file != NULL) {
+        fseek(eeprom.file, address, SEEK_SET);
+        fputc(value, eeprom.file);
+        fflush(eeprom.file);
+    }
+    eeprom.busy_until_ms = hal_clock_ms() + EEPROM_WRITE_MS;
+}
+
+bool hal_linux_setEepromFile(const char *path) {
+    if (eeprom.file != NULL) fclose(eeprom.file);
+    eeprom.file = NULL;
+    if (path != NULL) {
+        eeprom.file = fopen(path, "r+b");
+        if (eeprom.file == NULL) eeprom.file = fopen(path, "w+b");
+    }
+    loadEEPROM();
+    return path == NULL || eeprom.file != NULL;
+}
+
+uint32_t hal_linux_eepromWrites(void) {
+    return eeprom.writes;
+}
+
+// -------------------- END EEPROM --------------------
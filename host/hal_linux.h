@@ -0,0 +1,53 @@
+#ifndef HAL_LINUX_H
+#define	HAL_LINUX_H
+
+// Host-only controls for the Linux HAL backend (hal_linux.c). The firmware
+// modules only see hal.h; host tools use these to wire in models of the
+// buggy's peripherals and to inspect what the firmware drove.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "../hal.h"
+
+// I2C slave model attached to the bus, called byte by byte by the MSSP mock
+typedef struct {
+    uint8_t address; // 8-bit address with the R/W bit clear
+    void (*start)(bool is_read); // (repeated) start addressed to this device
+    void (*write)(uint8_t byte);
+    uint8_t (*read)(bool ack);
+    void (*stop)(void);
+} HalLinuxI2CDevice;
+
+void hal_linux_reset(void);
+
+// GPIO
+void hal_linux_setPin(HalPin pin, bool value); // drive an input pin
+void hal_linux_setPinReader(HalPin pin, bool (*reader)(void)); // input computed on each read
+uint8_t hal_linux_ledLevel(HalPin pin); // 0..255 brightness of an output, including software PWM
+
+// PWM
+uint8_t hal_linux_pwmDuty(HalPwmChannel channel);
+uint8_t hal_linux_pwmPeriod(void);
+void hal_linux_setPwmHook(void (*hook)(HalPwmChannel channel, uint8_t duty)); // called before the duty changes
+
+// Clock
+void hal_linux_advanceClock(uint32_t ms);
+
+// I2C
+void hal_linux_attachI2C(const HalLinuxI2CDevice *device);
+uint32_t hal_linux_i2cBytes(void); // bytes clocked on the bus since reset
+void hal_linux_hangI2C(void); // a slave holds the bus until the firmware recovers it
+uint32_t hal_linux_i2cRecoveries(void);
+uint32_t hal_linux_i2cOverruns(void); // events started before the previous one completed
+
+// UART
+void hal_linux_setUartSink(FILE *sink); // NULL discards TX
+void hal_linux_uartReceive(char ch); // byte arriving on RX
+void hal_linux_holdUartTX(bool hold); // leave TX in the buffer for the caller's own stand-in interrupt
+
+// EEPROM, erased at each reset unless backed by a file
+bool hal_linux_setEepromFile(const char *path); // load from and write through to path, created if missing; NULL detaches
+uint32_t hal_linux_eepromWrites(void); // bytes written since reset
+
+#endif	/* HAL_LINUX_H */
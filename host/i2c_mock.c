@@ -0,0 +1,128 @@
+// Drives the I2C2 transaction engine (i2c.c) against the MSSP mock in
+// hal_linux.c and the ColourClick model: queued transactions, NACKs and a
+// hung bus, and how long the CPU would have spun on the old busy-wait.
+//
+//   make -C host i2c_mock && ./host/build/i2c_mock
+//
+// Exits non-zero if any check fails.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_linux.h"
+#include "colourclick_model.h"
+#include "../i2c.h"
+
+#define ADDR 0x52
+#define ATIME 0x01
+#define CONTROL 0x0F
+#define CDATA 0x14
+#define AUTO_INCREMENT 0xA0 // command bit and auto-increment protocol
+#define BUS_US_PER_BYTE 90 // 9 clocks at 100kHz
+#define BUS_US_PER_CONDITION 10 // start, repeated start or stop
+
+static const uint16_t RGBC[MODEL_NUM_CHANNELS] = {1234, 300, 500, 700};
+
+static uint8_t order[8];
+static uint8_t num_done;
+static bool failed;
+
+static void source(uint8_t led, uint16_t rgbc[MODEL_NUM_CHANNELS]) {
+    (void) led;
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) rgbc[i] = RGBC[i];
+}
+
+static void check(bool ok, const char *what) {
+    printf("%s  %s\n", ok ? "ok  " : "FAIL", what);
+    if (!ok) failed = true;
+}
+
+static void record(I2C2Transaction *txn) {
+    order[num_done++] = txn->command;
+}
+
+static void reset(void) {
+    hal_linux_reset();
+    colourClickModel_attach(source);
+    I2C2_init();
+    // the model's reference integration time and gain, so reads return RGBC unscaled
+    uint8_t atime = 0xC0, again = 0x01;
+    I2C2Transaction txn = {.address = ADDR, .command = 0x80 | ATIME, .write = &atime, .num_write = 1};
+    I2C2_transfer(&txn);
+    txn = (I2C2Transaction) {.address = ADDR, .command = 0x80 | CONTROL, .write = &again, .num_write = 1};
+    I2C2_transfer(&txn);
+    num_done = 0;
+}
+
+// three transactions queued back to back while the caller keeps going
+static void queued(void) {
+    reset();
+    uint32_t bytes_start = hal_linux_i2cBytes();
+    uint8_t atime = 0xC0;
+    uint8_t c[2] = {0}, rgb[6] = {0};
+    I2C2Transaction write = {.address = ADDR, .command = 0x80 | ATIME, .write = &atime, .num_write = 1, .callback = record};
+    I2C2Transaction read_c = {.address = ADDR, .command = AUTO_INCREMENT | CDATA, .read = c, .num_read = 2, .callback = record};
+    I2C2Transaction read_rgb = {.address = ADDR, .command = AUTO_INCREMENT | (CDATA + 2), .read = rgb, .num_read = 6, .callback = record};
+    I2C2_submit(&write);
+    I2C2_submit(&read_c);
+    I2C2_submit(&read_rgb);
+    check(I2C2_isBusy() && write.status == I2C2_PENDING, "submit returns before the bus has moved");
+
+    uint32_t interrupts = 0;
+    while (I2C2_isBusy()) { // main loop: every pass is CPU time the busy-wait used to burn
+        hal_waitForInterrupt();
+        ++interrupts;
+    }
+    check(write.status == I2C2_DONE && read_c.status == I2C2_DONE && read_rgb.status == I2C2_DONE, "all three complete");
+    check(num_done == 3 && order[0] == write.command && order[1] == read_c.command && order[2] == read_rgb.command,
+            "callbacks run in submission order");
+    check(colourClickModel_register(ATIME) == 0xC0, "write reaches the register");
+    bool match = (c[0] | c[1] << 8) == RGBC[MODEL_C];
+    for (uint8_t i = 0; i < 3; ++i) match = match && (rgb[2 * i] | rgb[2 * i + 1] << 8) == RGBC[MODEL_R + i];
+    check(match, "reads return the model's RGBC");
+    check(hal_linux_i2cOverruns() == 0, "no event started before the previous one completed");
+
+    uint32_t bytes = hal_linux_i2cBytes() - bytes_start;
+    uint32_t conditions = 3 + 2 + 3; // starts, repeated starts, stops
+    printf("      %lu MSSP interrupts for %lu bytes; the busy-wait spun ~%lu us of CPU on the same transfers\n",
+            (unsigned long) interrupts, (unsigned long) bytes,
+            (unsigned long) (bytes * BUS_US_PER_BYTE + conditions * BUS_US_PER_CONDITION));
+}
+
+static void nack(void) {
+    reset();
+    uint8_t value = 0;
+    I2C2Transaction txn = {.address = 0x60, .command = 0x80, .read = &value, .num_read = 1};
+    uint16_t before = I2C2_getStats()->nacks;
+    check(I2C2_transfer(&txn) == I2C2_NACK, "missing device is NACKed");
+    check(I2C2_getStats()->nacks == before + 1, "NACK is counted");
+    I2C2Transaction next = {.address = ADDR, .command = AUTO_INCREMENT | CDATA, .read = &value, .num_read = 1};
+    check(I2C2_transfer(&next) == I2C2_DONE, "bus works after a NACK");
+}
+
+static void hang(void) {
+    reset();
+    uint8_t c[2] = {0};
+    I2C2Transaction stuck = {.address = ADDR, .command = AUTO_INCREMENT | CDATA, .read = c, .num_read = 2};
+    I2C2Transaction queued = {.address = ADDR, .command = AUTO_INCREMENT | CDATA, .read = c, .num_read = 2};
+    uint16_t before = I2C2_getStats()->timeouts;
+    hal_linux_hangI2C();
+    uint32_t start = hal_clock_ms();
+    I2C2_submit(&stuck);
+    I2C2_submit(&queued);
+    while (stuck.status == I2C2_PENDING) hal_waitForInterrupt();
+    check(stuck.status == I2C2_TIMEOUT, "hung transaction times out");
+    uint32_t waited = hal_clock_ms() - start;
+    printf("      gave up after %lu ms\n", (unsigned long) waited);
+    check(waited <= I2C2_TIMEOUT_MS, "within I2C2_TIMEOUT_MS");
+    check(hal_linux_i2cRecoveries() == 1 && I2C2_getStats()->timeouts == before + 1, "bus recovered once");
+    while (queued.status == I2C2_PENDING) hal_waitForInterrupt();
+    check(queued.status == I2C2_DONE && (c[0] | c[1] << 8) == RGBC[MODEL_C], "queued transaction completes after recovery");
+}
+
+int main(void) {
+    queued();
+    nack();
+    hang();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,271 @@
+// Runs buggy_navigate() through a simulated mine on the virtual clock and
+// reports the mission time, the motion primitives executed and whether the
+// buggy made it back to the start cell.
+//
+//   make -C host mine_sim && ./host/build/mine_sim [-n runs] [-v] [-e eeprom.bin] [-r ms] [-t telemetry.bin] host/mines/example.mine
+//
+// Primitives are counted by wrapping the firmware symbols at link time
+// (-Wl,--wrap), so the firmware itself is unchanged.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <setjmp.h>
+#include <time.h>
+#include "hal_linux.h"
+#include "sim.h"
+#include "../buggy.h"
+#include "../motors.h"
+#include "../colourClick.h"
+#include "../clock.h"
+#include "../i2c.h"
+#include "../serial.h"
+#include "../telemetry.h"
+
+#define TIME_LIMIT_MS (15UL * 60 * 1000) // a mission that takes longer is lost
+#define MAX_CARDS 64
+
+typedef enum { PRIM_SEARCH, PRIM_ADVANCE, PRIM_TURN, PRIM_RECENTRE, PRIM_REALIGN, NUM_PRIMS } Primitive;
+
+static const char *const PRIM_NAMES[NUM_PRIMS] = {"search", "advance", "turn", "recentre", "realign"};
+static const char *const CARD_NAMES[CLEAR + 1] = {"RED", "GREEN", "DBLUE", "YELLOW", "PINK", "ORANGE", "LBLUE", "WHITE", "BLACK", "CLEAR"};
+
+static struct {
+    uint32_t primitives[NUM_PRIMS];
+    Card cards[MAX_CARDS];
+    uint8_t num_cards;
+    bool verbose;
+    uint32_t reset_ms; // -r: brown-out this far into the mission
+    FILE *telemetry; // -t: capture of the first mission's EUSART4 output
+} run;
+
+static jmp_buf abort_jmp;
+
+// -------------------- START WRAPPERS --------------------
+
+Card __real_motors_search(uint8_t *cells_moved);
+bool __real_motors_queue(MotionType type, int8_t arg);
+void __real_clock_waitWhile(bool (*is_busy)(void));
+Card __real_colourClick_endCard(void);
+
+static void trace(const char *fmt, int value) {
+    if (!run.verbose) return;
+    SimPose pose = sim_pose();
+    printf("  %7lu ms  (%.2f, %.2f) %5.1f deg  ", (unsigned long) hal_clock_ms(), pose.x, pose.y, pose.heading);
+    printf(fmt, value);
+    printf("\n");
+}
+
+Card __wrap_motors_search(uint8_t *cells_moved) {
+    ++run.primitives[PRIM_SEARCH];
+    Card card = __real_motors_search(cells_moved);
+    trace("search: %d cells", *cells_moved);
+    return card;
+}
+
+#define MAX_QUEUED (2 * MOTION_QUEUE_SIZE) // waiting, running and finished but not yet traced
+
+// commands buggy.c queued, traced as the executor finishes them
+static struct {
+    MotionCommand commands[MAX_QUEUED];
+    uint8_t head, tail;
+    uint16_t finished;
+} queued;
+
+static void traceFinished(void) {
+    static const Primitive PRIMS[] = {[MOTION_ADVANCE] = PRIM_ADVANCE, [MOTION_TURN] = PRIM_TURN, [MOTION_RECENTRE] = PRIM_RECENTRE, [MOTION_REALIGN] = PRIM_REALIGN};
+    static const char *const FORMATS[] = {[MOTION_ADVANCE] = "advance %d", [MOTION_TURN] = "turn %d x 45 deg", [MOTION_RECENTRE] = "recentre", [MOTION_REALIGN] = "realign %d"};
+    uint16_t finished = motors_finished();
+    for (; queued.finished != finished && queued.tail != queued.head; ++queued.finished) {
+        MotionCommand command = queued.commands[queued.tail];
+        queued.tail = (queued.tail + 1) % MAX_QUEUED;
+        ++run.primitives[PRIMS[command.type]];
+        trace(FORMATS[command.type], command.arg);
+    }
+    if (queued.tail == queued.head) queued.finished = finished; // e.g. motors_calibrateAll()'s blocking calls
+}
+
+bool __wrap_motors_queue(MotionType type, int8_t arg) {
+    traceFinished();
+    bool is_queued = __real_motors_queue(type, arg);
+    if (is_queued) {
+        queued.commands[queued.head] = (MotionCommand) {type, arg};
+        queued.head = (queued.head + 1) % MAX_QUEUED;
+    }
+    traceFinished(); // a command that takes no time is already done
+    return is_queued;
+}
+
+static bool (*wait_is_busy)(void);
+
+static bool isBusyTraced(void) {
+    bool is_busy = wait_is_busy();
+    traceFinished();
+    return is_busy;
+}
+
+void __wrap_clock_waitWhile(bool (*is_busy)(void)) {
+    wait_is_busy = is_busy;
+    __real_clock_waitWhile(isBusyTraced);
+    traceFinished();
+}
+
+Card __wrap_colourClick_endCard(void) { // where motors_search() gets its card
+    Card card = __real_colourClick_endCard();
+    if (run.num_cards < MAX_CARDS) run.cards[run.num_cards++] = card;
+    if (run.verbose) printf("  %7lu ms  card %s, confidence %u\n", (unsigned long) hal_clock_ms(), CARD_NAMES[card], colourClick_getStats()->confidence);
+    return card;
+}
+
+// -------------------- END WRAPPERS --------------------
+
+static void abortRun(SimOutcome outcome) {
+    (void) outcome; // read back with sim_outcome()
+    longjmp(abort_jmp, 1);
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+// returns whether the buggy finished on the start cell
+static bool runMission(const SimMine *mine, bool report) {
+    memset(run.primitives, 0, sizeof(run.primitives));
+    queued.head = queued.tail;
+    run.num_cards = 0;
+
+    hal_linux_reset();
+    if (report) hal_linux_setUartSink(run.telemetry);
+    sim_start(mine, TIME_LIMIT_MS);
+    sim_setAbort(abortRun);
+    I2C2Stats i2c_start = *I2C2_getStats();
+    TelemetryStats telemetry_start = *telemetry_getStats();
+    MotionStats motion_start = *motors_getStats();
+    EUSART4_init();
+    buggy_init();
+
+    sim_scheduleReset(run.reset_ms);
+
+    if (setjmp(abort_jmp) == 0) {
+        buggy_navigate();
+        sim_finish();
+    }
+    if (sim_outcome() == SIM_RESET) { // the firmware starts over where the buggy stands and resumes from its checkpoints
+        if (run.verbose) printf("  %7lu ms  reset\n", (unsigned long) hal_clock_ms());
+        sim_powerCycle();
+        queued.head = queued.tail; // motors_init() empties the firmware's queue
+        if (setjmp(abort_jmp) == 0) {
+            EUSART4_init();
+            buggy_init();
+            buggy_navigate();
+            sim_finish();
+        }
+    }
+
+    int8_t x, y;
+    bool inside = sim_cell(&x, &y);
+    bool home = inside && x == mine->start_x && y == mine->start_y;
+    if (!report) return home;
+
+    static const char *const OUTCOMES[] = {"running", "finished", "timed out", "stalled", "reset"};
+    SimPose pose = sim_pose();
+    uint32_t total = 0;
+    printf("outcome:        %s\n", OUTCOMES[sim_outcome()]);
+    const ClockStats *stats = clock_getStats();
+    printf("mission time:   %.1f s (simulated)\n", hal_clock_ms() / 1000.0);
+    printf("time split:     moving %.1f s, stopped %.1f s; %u sleeps totalling %.1f s\n", stats->moving_ms / 1000.0,
+            stats->waiting_ms / 1000.0, stats->num_sleeps, stats->sleeping_ms / 1000.0);
+    printf("primitives:    ");
+    for (uint8_t i = 0; i < NUM_PRIMS; ++i) {
+        printf(" %s %lu,", PRIM_NAMES[i], (unsigned long) run.primitives[i]);
+        total += run.primitives[i];
+    }
+    printf(" total %lu\n", (unsigned long) total);
+    const I2C2Stats *i2c = I2C2_getStats();
+    printf("i2c bus:        %lu transactions, %lu bytes\n", (unsigned long) (i2c->transactions - i2c_start.transactions),
+            (unsigned long) (i2c->bytes - i2c_start.bytes));
+    const MotionStats *motion = motors_getStats();
+    printf("motion queue:   %u commands, %u handed off back to back, %u after %lu ms idle in total, at most %u waiting, %u rejected\n",
+            motion->commands - motion_start.commands, motion->handoffs - motion_start.handoffs, motion->idle_gaps - motion_start.idle_gaps,
+            (unsigned long) (motion->idle_ms - motion_start.idle_ms), motion->max_depth, motion->rejected - motion_start.rejected);
+    unsigned long switches = (unsigned long) (motion->switches - motion_start.switches);
+    printf("motor switches: %lu on the tick, at most %u us late, %.1f us on average\n", switches, motion->late_max_us,
+            switches == 0 ? 0.0 : (double) (motion->late_total_us - motion_start.late_total_us) / (double) switches);
+    printf("eeprom:         %lu bytes written\n", (unsigned long) hal_linux_eepromWrites());
+    const TelemetryStats *telemetry = telemetry_getStats();
+    printf("telemetry:      %lu records, %lu bytes, %lu dropped\n", (unsigned long) (telemetry->records - telemetry_start.records),
+            (unsigned long) (telemetry->bytes - telemetry_start.bytes), (unsigned long) (telemetry->dropped - telemetry_start.dropped));
+    printf("cards read:    ");
+    for (uint8_t i = 0; i < run.num_cards; ++i) printf(" %s", CARD_NAMES[run.cards[i]]);
+    printf("\n");
+    const ColourStats *colour = colourClick_getStats();
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i <= CLEAR; ++i) samples += colour->samples[i];
+    printf("card samples:   %lu over %u reads, %u voted\n", (unsigned long) samples, run.num_cards, colour->voted);
+    printf("final pose:     (%.2f, %.2f) %.1f deg, cell (%d, %d)\n", pose.x, pose.y, pose.heading, x, y);
+    printf("ended on start: %s\n", home ? "yes" : "no");
+    return home;
+}
+
+int main(int argc, char **argv) {
+    long runs = 1;
+    const char *path = NULL;
+    const char *eeprom_path = NULL;
+    const char *telemetry_path = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) runs = atol(argv[++i]);
+        else if (strcmp(argv[i], "-v") == 0) run.verbose = true;
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) eeprom_path = argv[++i];
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) run.reset_ms = (uint32_t) atol(argv[++i]);
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) telemetry_path = argv[++i];
+        else path = argv[i];
+    }
+    if (path == NULL || runs < 1) {
+        fprintf(stderr, "usage: %s [-n runs] [-v] [-e eeprom image] [-r reset ms] [-t telemetry capture] <mine file>\n", argv[0]);
+        return 2;
+    }
+
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        return 2;
+    }
+    SimMine mine;
+    char err[96];
+    bool loaded = sim_loadMine(&mine, file, err, sizeof(err));
+    fclose(file);
+    if (!loaded) {
+        fprintf(stderr, "%s: %s\n", path, err);
+        return 2;
+    }
+
+    if (!hal_linux_setEepromFile(eeprom_path)) { // calibration saved by an earlier run, loaded by buggy_init()
+        perror(eeprom_path);
+        return 2;
+    }
+
+    if (telemetry_path != NULL) {
+        run.telemetry = fopen(telemetry_path, "wb");
+        if (run.telemetry == NULL) {
+            perror(telemetry_path);
+            return 2;
+        }
+    }
+
+    bool home = runMission(&mine, true);
+    if (run.telemetry != NULL) fclose(run.telemetry);
+    if (runs > 1) { // throughput, without the per-primitive trace
+        bool verbose = run.verbose;
+        run.verbose = false;
+        double start = now_ms();
+        for (long i = 0; i < runs; ++i) runMission(&mine, false);
+        double elapsed = now_ms() - start;
+        printf("host time:      %.3f ms/mission over %ld runs\n", elapsed / (double) runs, runs);
+        run.verbose = verbose;
+    }
+    return home ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+// Host profiling harness: runs the firmware hot paths against the Linux HAL
+// backend so they can be timed here or under perf/gprof/valgrind.
+//
+//   make -C host profile && ./host/build/profile [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "hal_linux.h"
+#include "colourclick_model.h"
+#include "../buggy.h"
+#include "../colourClick.h"
+#include "../serial.h"
+#include "../i2c.h"
+
+#define NUM_SAMPLES 4
+
+// raw LED-on RGBC readings in front of a card
+static const uint16_t SAMPLES[NUM_SAMPLES][MODEL_NUM_CHANNELS] = {
+    {12000, 9000, 1800, 1500}, // red
+    {14000, 2600, 7200, 2000}, // green
+    {40000, 16000, 12000, 8400}, // white
+    {1500, 600, 450, 320}, // black
+};
+
+static uint8_t sample_idx = 0;
+
+static void source(uint8_t led, uint16_t rgbc[MODEL_NUM_CHANNELS]) {
+    if (led == 0) { // against a wall under the shroud
+        rgbc[MODEL_C] = 100;
+        return;
+    }
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) rgbc[i] = SAMPLES[sample_idx][i];
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(argv[1]) : 100000;
+
+    hal_linux_reset();
+    colourClickModel_attach(source);
+    buggy_init();
+    EUSART4_init();
+    I2C2Stats init = *I2C2_getStats();
+    printf("colourClick_init:     %lu I2C transactions, %lu bytes; register shadow %s\n", (unsigned long) init.transactions,
+            (unsigned long) init.bytes, colourClick_verifyRegisters() ? "matches" : "DIFFERS");
+
+    // colour classification
+    double start = now_ns();
+    I2C2Stats i2c_start = *I2C2_getStats();
+    uint32_t sim_start = hal_clock_ms();
+    uint32_t cards[CLEAR + 1] = {0};
+    for (long i = 0; i < iterations; ++i) {
+        sample_idx = (uint8_t) (i % NUM_SAMPLES);
+        ++cards[colourClick_readCard()];
+    }
+    double elapsed = now_ns() - start;
+    const I2C2Stats *i2c = I2C2_getStats();
+    printf("colourClick_readCard: %8.1f ns/call, %.1f I2C transactions and %.1f bytes/call (red %u, green %u, white %u, black %u)\n",
+            elapsed / (double) iterations, (double) (i2c->transactions - i2c_start.transactions) / (double) iterations,
+            (double) (i2c->bytes - i2c_start.bytes) / (double) iterations, cards[RED], cards[GREEN], cards[WHITE], cards[BLACK]);
+    printf("                      %8.1f ms/call simulated, %u ms integration\n",
+            (double) (hal_clock_ms() - sim_start) / (double) iterations, colourClick_integrationMs());
+    const ColourStats *colour = colourClick_getStats();
+    printf("                      samples per read: red %.2f, green %.2f, white %.2f, black %.2f; %u voted\n",
+            (double) colour->samples[RED] / cards[RED], (double) colour->samples[GREEN] / cards[GREEN],
+            (double) colour->samples[WHITE] / cards[WHITE], (double) colour->samples[BLACK] / cards[BLACK], colour->voted);
+
+    // navigation decisions; a turn card then a white card keeps the map near the start
+    buggy_navigate(); // also resets the map
+    start = now_ns();
+    for (long i = 0; i < iterations; ++i) {
+        processCard(i % 2 ? GREEN : RED);
+    }
+    elapsed = now_ns() - start;
+    printf("processCard:          %8.1f ns/call\n", elapsed / (double) iterations);
+
+    // full mission, ending at the first (white) wall
+    sample_idx = 2;
+    start = now_ns();
+    for (long i = 0; i < iterations / 100 + 1; ++i) {
+        buggy_navigate();
+    }
+    elapsed = now_ns() - start;
+    printf("buggy_navigate:       %8.1f ns/call\n", elapsed / (double) (iterations / 100 + 1));
+
+    // serial ring buffers, drained by the stand-in TX interrupt
+    start = now_ns();
+    for (long i = 0; i < iterations; ++i) {
+        EUSART4_sendString("profile\r\n");
+    }
+    elapsed = now_ns() - start;
+    printf("EUSART4_sendString:   %8.1f ns/call\n", elapsed / (double) iterations);
+
+    // a calibration readout, formatted into a buffer as it used to be and straight into TX
+    char buf[50];
+    start = now_ns();
+    for (long i = 0; i < iterations; ++i) {
+        sprintf(buf, "%s h=%u s=%u\r\n", "YELLOW", (unsigned) (i & 0x1ff), (unsigned) (i & 0xff));
+        EUSART4_sendString(buf);
+    }
+    double sprintf_ns = (now_ns() - start) / (double) iterations;
+    start = now_ns();
+    for (long i = 0; i < iterations; ++i) {
+        EUSART4_print("%s h=%u s=%u\r\n", "YELLOW", (unsigned) (i & 0x1ff), (unsigned) (i & 0xff));
+    }
+    elapsed = now_ns() - start;
+    printf("EUSART4_print:        %8.1f ns/call (sprintf and EUSART4_sendString %.1f)\n", elapsed / (double) iterations, sprintf_ns);
+
+    return 0;
+}
@@ -0,0 +1,386 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "sim.h"
+#include "hal_linux.h"
+#include "colourclick_model.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// motor response, calibrated against the firmware's default durations: the
+// drive speed is proportional to the power above stall, which gives one cell
+// in forward_fast_duration at the fast powers and roughly backward_duration at
+// the slow powers. Wheel imbalance is assumed calibrated out by the powers.
+#define STALL_POWER 50
+#define SPEED (1.0 / (690.0 * 48.0)) // cells per ms per unit of power above stall
+#define TURN_RATE (90.0 / (350.0 * 35.0)) // degrees per ms per unit of power above stall
+
+#define BUGGY_FRONT 0.25 // cells from the buggy's centre to its bumper, gives recenter_duration
+#define SENSOR_RANGE 0.05 // cells from the wall at which the shroud darkens the clear channel
+#define SQUARE_UP_ANGLE 30.0 // degrees of misalignment a push against a wall corrects
+
+// sensor response
+#define AMBIENT_C 2000 // clear channel in open space with the LED off
+#define DARK_C 40 // clear channel under the shroud with the LED off
+#define WHITE_LEVEL 200.0 // white-calibrated reading of the white card
+#define BLACK_LEVEL 20.0
+static const double SENSITIVITY[3] = {1.0, 0.754, 0.527}; // R, G, B sensitivity relative to R, see README
+
+// hue, saturation and lightness of the physical cards
+static const double CARD_HSL[CLEAR][3] = {
+    [RED]    = {349, 0.56, 0.45},
+    [GREEN]  = {147, 0.21, 0.40},
+    [DBLUE]  = {213, 0.31, 0.40},
+    [YELLOW] = { 13, 0.38, 0.55},
+    [PINK]   = {351, 0.27, 0.55},
+    [ORANGE] = {352, 0.46, 0.50},
+    [LBLUE]  = {186, 0.11, 0.50},
+    [WHITE]  = {  0, 0.00, WHITE_LEVEL / 255},
+    [BLACK]  = {  0, 0.00, BLACK_LEVEL / 255},
+};
+
+static const char *const CARD_NAMES[CLEAR] = {"RED", "GREEN", "DBLUE", "YELLOW", "PINK", "ORANGE", "LBLUE", "WHITE", "BLACK"};
+static const char *const SIDE_NAMES[SIM_NUM_SIDES] = {"N", "E", "S", "W"};
+static const int8_t SIDE_DX[SIM_NUM_SIDES] = {0, 1, 0, -1};
+static const int8_t SIDE_DY[SIM_NUM_SIDES] = {1, 0, -1, 0};
+
+static struct {
+    const SimMine *mine;
+    SimPose pose;
+    uint32_t pose_ms; // virtual time the pose was integrated to
+    uint32_t time_limit_ms;
+    uint32_t reset_ms; // 0 if no reset is scheduled
+    SimOutcome outcome;
+    void (*abort)(SimOutcome outcome);
+    uint16_t card_rgbc[CLEAR][MODEL_NUM_CHANNELS];
+} sim;
+
+// -------------------- START MINE --------------------
+
+void sim_emptyMine(SimMine *mine, uint8_t width, uint8_t height) {
+    memset(mine, 0, sizeof(*mine));
+    mine->width = width;
+    mine->height = height;
+    mine->start_dir = SIM_N;
+    for (uint8_t y = 0; y < SIM_MAX_SIZE; ++y) {
+        for (uint8_t x = 0; x < SIM_MAX_SIZE; ++x) {
+            for (uint8_t side = 0; side < SIM_NUM_SIDES; ++side) {
+                mine->cards[y][x][side] = SIM_NO_CARD;
+            }
+        }
+    }
+    for (uint8_t x = 0; x < width; ++x) { // boundary
+        mine->walls[0][x][SIM_S] = true;
+        mine->walls[height - 1][x][SIM_N] = true;
+    }
+    for (uint8_t y = 0; y < height; ++y) {
+        mine->walls[y][0][SIM_W] = true;
+        mine->walls[y][width - 1][SIM_E] = true;
+    }
+}
+
+void sim_setWall(SimMine *mine, uint8_t x, uint8_t y, SimSide side, int8_t card) {
+    mine->walls[y][x][side] = true;
+    mine->cards[y][x][side] = card;
+    int8_t nx = (int8_t) (x + SIDE_DX[side]);
+    int8_t ny = (int8_t) (y + SIDE_DY[side]);
+    if (nx >= 0 && nx < mine->width && ny >= 0 && ny < mine->height) {
+        mine->walls[ny][nx][(side + 2) % SIM_NUM_SIDES] = true;
+    }
+}
+
+static int8_t parseName(const char *name, const char *const *names, uint8_t num) {
+    for (uint8_t i = 0; i < num; ++i) {
+        if (strcmp(name, names[i]) == 0) return (int8_t) i;
+    }
+    return -1;
+}
+
+// one statement per line, '#' starts a comment:
+//   size <width> <height>
+//   start <x> <y> <N|E|S|W>
+//   wall <x> <y> <N|E|S|W> [card]   wall on that side of cell (x, y), optionally with a card facing the cell
+bool sim_loadMine(SimMine *mine, FILE *file, char *err, size_t err_size) {
+    char line[128];
+    unsigned line_num = 0;
+    bool has_size = false;
+    sim_emptyMine(mine, SIM_MAX_SIZE, SIM_MAX_SIZE);
+    while (fgets(line, sizeof(line), file) != NULL) {
+        ++line_num;
+        char *comment = strchr(line, '#');
+        if (comment != NULL) *comment = '\0';
+        char keyword[16], side[4], card[16];
+        int x, y;
+        int fields = sscanf(line, "%15s %d %d %3s %15s", keyword, &x, &y, side, card);
+        if (fields <= 0) continue; // blank line
+
+        if (strcmp(keyword, "size") == 0 && fields == 3) {
+            if (x < 1 || y < 1 || x > SIM_MAX_SIZE || y > SIM_MAX_SIZE) {
+                snprintf(err, err_size, "line %u: size must be 1..%d", line_num, SIM_MAX_SIZE);
+                return false;
+            }
+            sim_emptyMine(mine, (uint8_t) x, (uint8_t) y);
+            has_size = true;
+            continue;
+        }
+        if (!has_size) {
+            snprintf(err, err_size, "line %u: expected size first", line_num);
+            return false;
+        }
+        if (fields < 4 || x < 0 || y < 0 || x >= mine->width || y >= mine->height) {
+            snprintf(err, err_size, "line %u: expected <keyword> <x> <y> <side> inside the mine", line_num);
+            return false;
+        }
+        int8_t side_idx = parseName(side, SIDE_NAMES, SIM_NUM_SIDES);
+        if (side_idx < 0) {
+            snprintf(err, err_size, "line %u: unknown side '%s'", line_num, side);
+            return false;
+        }
+        if (strcmp(keyword, "start") == 0 && fields == 4) {
+            mine->start_x = (uint8_t) x;
+            mine->start_y = (uint8_t) y;
+            mine->start_dir = (SimSide) side_idx;
+        } else if (strcmp(keyword, "wall") == 0) {
+            int8_t card_idx = SIM_NO_CARD;
+            if (fields == 5 && (card_idx = parseName(card, CARD_NAMES, CLEAR)) < 0) {
+                snprintf(err, err_size, "line %u: unknown card '%s'", line_num, card);
+                return false;
+            }
+            sim_setWall(mine, (uint8_t) x, (uint8_t) y, (SimSide) side_idx, card_idx);
+        } else {
+            snprintf(err, err_size, "line %u: unknown statement '%s'", line_num, keyword);
+            return false;
+        }
+    }
+    if (!has_size) {
+        snprintf(err, err_size, "no size statement");
+        return false;
+    }
+    return true;
+}
+
+// -------------------- END MINE --------------------
+// -------------------- START KINEMATICS --------------------
+
+static void abortMission(SimOutcome outcome) {
+    sim.outcome = outcome;
+    if (sim.abort != NULL) sim.abort(outcome);
+}
+
+static double normaliseHeading(double heading) {
+    heading = fmod(heading, 360);
+    return heading < 0 ? heading + 360 : heading;
+}
+
+// distance from (x, y) along heading to the first wall, and the wall face hit
+static double raycast(double x, double y, double heading, int8_t *hit_x, int8_t *hit_y, SimSide *hit_side) {
+    double dx = sin(heading * M_PI / 180);
+    double dy = cos(heading * M_PI / 180);
+    int8_t cx = (int8_t) floor(x);
+    int8_t cy = (int8_t) floor(y);
+    for (uint8_t i = 0; i < 4 * SIM_MAX_SIZE; ++i) {
+        double tx = dx > 1e-9 ? (cx + 1 - x) / dx : dx < -1e-9 ? (cx - x) / dx : INFINITY;
+        double ty = dy > 1e-9 ? (cy + 1 - y) / dy : dy < -1e-9 ? (cy - y) / dy : INFINITY;
+        SimSide side = tx < ty ? (dx > 0 ? SIM_E : SIM_W) : (dy > 0 ? SIM_N : SIM_S);
+        if (cx < 0 || cy < 0 || cx >= sim.mine->width || cy >= sim.mine->height || sim.mine->walls[cy][cx][side]) {
+            *hit_x = cx;
+            *hit_y = cy;
+            *hit_side = side;
+            return tx < ty ? tx : ty;
+        }
+        cx = (int8_t) (cx + SIDE_DX[side]);
+        cy = (int8_t) (cy + SIDE_DY[side]);
+    }
+    return INFINITY;
+}
+
+// signed wheel power in percent, as set by motors_setMotorPWM()
+static double wheelPower(HalPwmChannel pos, HalPwmChannel neg) {
+    uint8_t period = hal_linux_pwmPeriod();
+    if (period == 0) return 0;
+    return ((double) hal_linux_pwmDuty(neg) - hal_linux_pwmDuty(pos)) * 100 / period;
+}
+
+static double wheelSpeed(double power) {
+    double above_stall = fabs(power) - STALL_POWER;
+    if (above_stall <= 0) return 0;
+    return power > 0 ? above_stall : -above_stall;
+}
+
+// forward speed in cells/ms and rotation in degrees/ms (clockwise)
+static void velocity(double *v, double *w) {
+    double left = wheelSpeed(wheelPower(HAL_PWM_LEFT_POS, HAL_PWM_LEFT_NEG));
+    double right = wheelSpeed(wheelPower(HAL_PWM_RIGHT_POS, HAL_PWM_RIGHT_NEG));
+    if ((left > 0 && right < 0) || (left < 0 && right > 0)) { // turning on the spot
+        *v = 0;
+        *w = (left - right) / 2 * TURN_RATE;
+    } else {
+        *v = (left + right) / 2 * SPEED;
+        *w = 0;
+    }
+}
+
+// integrate the pose up to the current virtual time
+static void update(void) {
+    uint32_t now = hal_clock_ms();
+    if (sim.outcome == SIM_RUNNING && now > sim.time_limit_ms) abortMission(SIM_TIMEOUT);
+    if (sim.outcome == SIM_RUNNING && sim.reset_ms != 0 && now >= sim.reset_ms) {
+        sim.reset_ms = 0; // once
+        abortMission(SIM_RESET);
+    }
+    double dt = (double) (now - sim.pose_ms);
+    sim.pose_ms = now;
+    if (dt <= 0) return;
+
+    double v, w;
+    velocity(&v, &w);
+    if (w != 0) {
+        sim.pose.heading = normaliseHeading(sim.pose.heading + w * dt);
+    } else if (v != 0) {
+        double dir = v > 0 ? sim.pose.heading : normaliseHeading(sim.pose.heading + 180);
+        int8_t hx, hy;
+        SimSide side;
+        double free = raycast(sim.pose.x, sim.pose.y, dir, &hx, &hy, &side) - BUGGY_FRONT;
+        double dist = fabs(v) * dt;
+        if (dist >= free) { // ran into a wall, pushing squares the buggy up against it
+            dist = free > 0 ? free : 0;
+            double normal = side * 90.0;
+            double error = normaliseHeading(dir - normal + 180) - 180;
+            if (fabs(error) < SQUARE_UP_ANGLE) {
+                dir = normal;
+                sim.pose.heading = v > 0 ? normal : normaliseHeading(normal + 180);
+            }
+        }
+        sim.pose.x += dist * sin(dir * M_PI / 180);
+        sim.pose.y += dist * cos(dir * M_PI / 180);
+    }
+}
+
+static void onPwm(HalPwmChannel channel, uint8_t duty) {
+    (void) channel;
+    (void) duty;
+    update(); // finish the segment driven by the old duty
+}
+
+// -------------------- END KINEMATICS --------------------
+// -------------------- START SENSOR --------------------
+
+static void cardReading(Card card, uint16_t rgbc[MODEL_NUM_CHANNELS]) {
+    // HSL to white-calibrated RGB, then undo the white calibration to get raw counts
+    double h = CARD_HSL[card][0] / 60, s = CARD_HSL[card][1], l = CARD_HSL[card][2];
+    double c = (1 - fabs(2 * l - 1)) * s;
+    double x = c * (1 - fabs(fmod(h, 2) - 1));
+    double m = l - c / 2;
+    double rgb[3] = {m, m, m};
+    uint8_t sector = (uint8_t) h % 6;
+    static const uint8_t MAX_IDX[6] = {0, 1, 1, 2, 2, 0};
+    static const uint8_t MID_IDX[6] = {1, 0, 2, 1, 0, 2};
+    rgb[MAX_IDX[sector]] += c;
+    rgb[MID_IDX[sector]] += x;
+
+    double clear = 0;
+    for (uint8_t i = 0; i < 3; ++i) {
+        double raw = rgb[i] * 255 * 256 * SENSITIVITY[i];
+        rgbc[MODEL_R + i] = (uint16_t) (raw > 65535 ? 65535 : raw);
+        clear += raw;
+    }
+    rgbc[MODEL_C] = (uint16_t) (clear > 65535 ? 65535 : clear);
+}
+
+static void source(uint8_t led, uint16_t rgbc[MODEL_NUM_CHANNELS]) {
+    update();
+    int8_t x, y;
+    SimSide side;
+    double distance = raycast(sim.pose.x, sim.pose.y, sim.pose.heading, &x, &y, &side) - BUGGY_FRONT;
+    if (distance > SENSOR_RANGE) { // open space, shroud lets ambient light in
+        rgbc[MODEL_C] = AMBIENT_C;
+        rgbc[MODEL_R] = AMBIENT_C / 3;
+        rgbc[MODEL_G] = AMBIENT_C / 3;
+        rgbc[MODEL_B] = AMBIENT_C / 3;
+        return;
+    }
+    int8_t card = x >= 0 && y >= 0 && x < sim.mine->width && y < sim.mine->height ? sim.mine->cards[y][x][side] : SIM_NO_CARD;
+    const uint16_t *lit = sim.card_rgbc[card == SIM_NO_CARD ? BLACK : card];
+    for (uint8_t i = 0; i < MODEL_NUM_CHANNELS; ++i) {
+        uint32_t value = DARK_C / 4 + (uint32_t) lit[i] * led / 255;
+        rgbc[i] = (uint16_t) (value > 65535 ? 65535 : value); // sensor saturates
+    }
+}
+
+// time in ms until the sensor comes within range of the wall ahead, negative if never
+static double timeToWall(void) {
+    double v, w;
+    velocity(&v, &w);
+    if (w != 0 || v <= 0) return -1;
+    int8_t x, y;
+    SimSide side;
+    double distance = raycast(sim.pose.x, sim.pose.y, sim.pose.heading, &x, &y, &side) - BUGGY_FRONT - SENSOR_RANGE;
+    return distance > 0 ? distance / v : 0;
+}
+
+// the firmware polls the INT pin while waiting for a wall, jump straight to the event
+static bool readInt(void) {
+    update();
+    if (!colourClickModel_readInt()) return false;
+    double wait = timeToWall();
+    if (wait < 0) abortMission(SIM_STALLED);
+    hal_linux_advanceClock((uint32_t) ceil(wait) + 1);
+    update();
+    return colourClickModel_readInt();
+}
+
+// -------------------- END SENSOR --------------------
+
+void sim_start(const SimMine *mine, uint32_t time_limit_ms) {
+    sim.mine = mine;
+    sim.pose.x = mine->start_x + 0.5;
+    sim.pose.y = mine->start_y + 0.5;
+    sim.pose.heading = mine->start_dir * 90.0;
+    sim.pose_ms = hal_clock_ms();
+    sim.time_limit_ms = sim.pose_ms + time_limit_ms;
+    sim.reset_ms = 0;
+    sim.outcome = SIM_RUNNING;
+    for (uint8_t card = 0; card < CLEAR; ++card) cardReading((Card) card, sim.card_rgbc[card]);
+
+    colourClickModel_attach(source);
+    hal_linux_setPinReader(HAL_COLOUR_INT, readInt);
+    hal_linux_setPwmHook(onPwm);
+}
+
+void sim_finish(void) {
+    update();
+    if (sim.outcome == SIM_RUNNING) sim.outcome = SIM_FINISHED;
+}
+
+SimPose sim_pose(void) {
+    update();
+    return sim.pose;
+}
+
+bool sim_cell(int8_t *x, int8_t *y) {
+    SimPose pose = sim_pose();
+    *x = (int8_t) floor(pose.x);
+    *y = (int8_t) floor(pose.y);
+    return *x >= 0 && *y >= 0 && *x < sim.mine->width && *y < sim.mine->height;
+}
+
+SimOutcome sim_outcome(void) {
+    return sim.outcome;
+}
+
+void sim_setAbort(void (*abort)(SimOutcome outcome)) {
+    sim.abort = abort;
+}
+
+void sim_scheduleReset(uint32_t at_ms) {
+    sim.reset_ms = at_ms;
+}
+
+void sim_powerCycle(void) {
+    for (uint8_t i = 0; i < HAL_NUM_PWM; ++i) hal_pwm_setDuty((HalPwmChannel) i, 0); // the pose runs up to now first
+    sim.outcome = SIM_RUNNING;
+}
@@ -0,0 +1,61 @@
+#ifndef SIM_H
+#define	SIM_H
+
+// Discrete-event model of the grid mine from the README. The buggy's pose is
+// integrated from the motor PWM duties between events on the virtual clock,
+// and the ColourClick model is fed from what the sensor faces, so the
+// unmodified firmware can run whole missions in host time.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "../colourClick.h"
+
+#define SIM_MAX_SIZE 6 // MAP_SIZE in buggy.c
+#define SIM_NO_CARD -1 // plain black wall
+
+typedef enum { SIM_N, SIM_E, SIM_S, SIM_W, SIM_NUM_SIDES } SimSide;
+
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint8_t start_x; // must match START_X, START_Y and START_DIR in buggy.c
+    uint8_t start_y;
+    SimSide start_dir;
+    bool walls[SIM_MAX_SIZE][SIM_MAX_SIZE][SIM_NUM_SIDES]; // [y][x][side], kept consistent on both faces
+    int8_t cards[SIM_MAX_SIZE][SIM_MAX_SIZE][SIM_NUM_SIDES]; // Card on the face seen from inside the cell
+} SimMine;
+
+typedef struct {
+    double x; // cells, origin at the SW corner of the start cell's row/column 0
+    double y;
+    double heading; // degrees clockwise from north
+} SimPose;
+
+typedef enum {
+    SIM_RUNNING,
+    SIM_FINISHED, // buggy_navigate() returned
+    SIM_TIMEOUT, // mission exceeded the time limit
+    SIM_STALLED, // firmware waited for a wall it can never reach
+    SIM_RESET, // the PIC reset mid-mission, see sim_scheduleReset()
+} SimOutcome;
+
+void sim_emptyMine(SimMine *mine, uint8_t width, uint8_t height);
+void sim_setWall(SimMine *mine, uint8_t x, uint8_t y, SimSide side, int8_t card);
+bool sim_loadMine(SimMine *mine, FILE *file, char *err, size_t err_size);
+
+void sim_start(const SimMine *mine, uint32_t time_limit_ms); // place the buggy and hook into the HAL
+void sim_finish(void); // the firmware returned, stop checking the time limit
+SimPose sim_pose(void);
+bool sim_cell(int8_t *x, int8_t *y); // cell under the buggy's centre, false if outside the mine
+SimOutcome sim_outcome(void);
+
+// used by the runner to abort a mission from inside the firmware
+void sim_setAbort(void (*abort)(SimOutcome outcome));
+
+// brown-out: abort with SIM_RESET once the clock passes at_ms (0: never);
+// the runner then calls sim_powerCycle() and restarts the firmware where the buggy stands
+void sim_scheduleReset(uint32_t at_ms);
+void sim_powerCycle(void); // motors off, mission running again
+
+#endif	/* SIM_H */
@@ -0,0 +1,200 @@
+// Decodes a capture of the binary telemetry stream (telemetry.h) into CSV or
+// JSON lines on stdout, with a frame count on stderr.
+//
+//   make -C host telemetry_decode && ./host/build/telemetry_decode [-j] [-r record] capture.bin
+//
+// -r keeps one record type (start, rgbc, motors, pose, card) and gives the CSV
+// named columns; without it every record is a "ms,record,values..." row. -j
+// writes one JSON object per record instead. A capture can start or end
+// mid-frame, and frames that fail COBS, the length or the CRC check are
+// counted and skipped; decoding picks up again at the next 0x00.
+// mine_sim -t writes a capture of a simulated mission.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "../telemetry.h"
+#include "../crc16.h"
+
+#define MAX_FRAME 64 // longer than any record, longer runs are framing errors
+#define MAX_FIELDS 6
+
+typedef enum { U8, S8, U16 } FieldType;
+
+typedef struct {
+    const char *name;
+    FieldType type;
+} Field;
+
+typedef struct {
+    const char *name;
+    uint8_t num_fields;
+    Field fields[MAX_FIELDS];
+} Record;
+
+// indexed by TelemetryRecord
+static const Record RECORDS[] = {
+    [TELEMETRY_START] = {"start", 1, {{"version", U8}}},
+    [TELEMETRY_RGBC] = {"rgbc", 5, {{"c", U16}, {"r", U16}, {"g", U16}, {"b", U16}, {"led", U8}}},
+    [TELEMETRY_MOTORS] = {"motors", 2, {{"left", S8}, {"right", S8}}},
+    [TELEMETRY_POSE] = {"pose", 5, {{"x", S8}, {"y", S8}, {"dir", U8}, {"walls", U8}, {"steps", U8}}},
+    [TELEMETRY_CARD] = {"card", 3, {{"card", U8}, {"confidence", U8}, {"samples", U8}}},
+};
+#define NUM_RECORDS (sizeof(RECORDS) / sizeof(RECORDS[0]))
+
+static const char *const CARD_NAMES[] = {"RED", "GREEN", "DBLUE", "YELLOW", "PINK", "ORANGE", "LBLUE", "WHITE", "BLACK", "CLEAR"};
+#define NUM_CARD_NAMES (sizeof(CARD_NAMES) / sizeof(CARD_NAMES[0]))
+
+static struct {
+    bool json;
+    int only; // record type kept, 0 for all
+} options;
+
+static struct {
+    unsigned long frames, bad_cobs, bad_length, bad_crc, unknown;
+    unsigned long records[NUM_RECORDS];
+} counts;
+
+static uint8_t fieldSize(FieldType type) {
+    return type == U16 ? 2 : 1;
+}
+
+static uint8_t recordLength(const Record *record) {
+    uint8_t length = 1 + 4 + 2; // type, timestamp, CRC
+    for (uint8_t i = 0; i < record->num_fields; ++i) length += fieldSize(record->fields[i].type);
+    return length;
+}
+
+// returns the decoded length, or -1 if a code byte points past the frame
+static int cobsDecode(const uint8_t *frame, int length, uint8_t *out) {
+    int n = 0;
+    int i = 0;
+    while (i < length) {
+        uint8_t code = frame[i++];
+        if (code == 0 || i + code - 1 > length) return -1;
+        for (uint8_t k = 1; k < code; ++k) out[n++] = frame[i++];
+        if (code < 0xff && i < length) out[n++] = 0;
+    }
+    return n;
+}
+
+static void printCsvHeader(void) {
+    if (options.only == 0) {
+        printf("ms,record,values\n");
+        return;
+    }
+    const Record *record = &RECORDS[options.only];
+    printf("ms");
+    for (uint8_t i = 0; i < record->num_fields; ++i) printf(",%s", record->fields[i].name);
+    printf("\n");
+}
+
+static void printRecord(uint8_t type, const uint8_t *bytes) {
+    const Record *record = &RECORDS[type];
+    uint32_t ms = bytes[1] | (uint32_t) bytes[2] << 8 | (uint32_t) bytes[3] << 16 | (uint32_t) bytes[4] << 24;
+    if (options.json) printf("{\"ms\":%lu,\"record\":\"%s\"", (unsigned long) ms, record->name);
+    else if (options.only == 0) printf("%lu,%s", (unsigned long) ms, record->name);
+    else printf("%lu", (unsigned long) ms);
+    const uint8_t *field = bytes + 5;
+    for (uint8_t i = 0; i < record->num_fields; ++i) {
+        long value;
+        switch (record->fields[i].type) {
+            case S8: value = (int8_t) field[0]; break;
+            case U16: value = field[0] | (uint16_t) (field[1] << 8); break;
+            default: value = field[0]; break;
+        }
+        field += fieldSize(record->fields[i].type);
+        if (options.json) {
+            if (type == TELEMETRY_CARD && i == 0 && (unsigned long) value < NUM_CARD_NAMES) printf(",\"card\":\"%s\"", CARD_NAMES[value]);
+            else printf(",\"%s\":%ld", record->fields[i].name, value);
+        } else {
+            if (type == TELEMETRY_CARD && i == 0 && (unsigned long) value < NUM_CARD_NAMES) printf(",%s", CARD_NAMES[value]);
+            else printf(",%ld", value);
+        }
+    }
+    printf(options.json ? "}\n" : "\n");
+}
+
+typedef enum { FRAME_OK, FRAME_BAD_COBS, FRAME_UNKNOWN, FRAME_BAD_LENGTH, FRAME_BAD_CRC } FrameResult;
+
+static FrameResult checkFrame(const uint8_t *frame, int length, uint8_t *bytes) {
+    int n = cobsDecode(frame, length, bytes);
+    if (n < 0) return FRAME_BAD_COBS;
+    uint8_t type = n > 0 ? bytes[0] : 0;
+    if (type == 0 || type >= NUM_RECORDS) return FRAME_UNKNOWN;
+    if (n != recordLength(&RECORDS[type])) return FRAME_BAD_LENGTH;
+    uint16_t crc = bytes[n - 2] | (uint16_t) (bytes[n - 1] << 8);
+    return crc16(bytes, (uint16_t) (n - 2)) == crc ? FRAME_OK : FRAME_BAD_CRC;
+}
+
+// the bytes before the first delimiter are only a frame if they check out,
+// a capture can start mid-frame
+static void decodeFrame(const uint8_t *frame, int length, bool is_lead_in) {
+    if (length == 0) return; // back-to-back delimiters
+    uint8_t bytes[MAX_FRAME];
+    FrameResult result = length > MAX_FRAME ? FRAME_BAD_LENGTH : checkFrame(frame, length, bytes);
+    if (is_lead_in && result != FRAME_OK) return;
+    ++counts.frames;
+    switch (result) {
+        case FRAME_BAD_COBS: ++counts.bad_cobs; return;
+        case FRAME_UNKNOWN: ++counts.unknown; return;
+        case FRAME_BAD_LENGTH: ++counts.bad_length; return;
+        case FRAME_BAD_CRC: ++counts.bad_crc; return;
+        default: break;
+    }
+    ++counts.records[bytes[0]];
+    if (options.only == 0 || options.only == bytes[0]) printRecord(bytes[0], bytes);
+}
+
+int main(int argc, char **argv) {
+    const char *path = NULL;
+    const char *only = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-j") == 0) options.json = true;
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) only = argv[++i];
+        else path = argv[i];
+    }
+    if (only != NULL) {
+        for (unsigned type = 1; type < NUM_RECORDS; ++type) {
+            if (strcmp(only, RECORDS[type].name) == 0) options.only = (int) type;
+        }
+    }
+    if (path == NULL || (only != NULL && options.only == 0)) {
+        fprintf(stderr, "usage: %s [-j] [-r start|rgbc|motors|pose|card] <capture>\n", argv[0]);
+        return 2;
+    }
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return 2;
+    }
+
+    if (!options.json) printCsvHeader();
+    uint8_t frame[MAX_FRAME];
+    int length = 0; // past MAX_FRAME once a frame outgrows the buffer, to be skipped
+    bool is_lead_in = true;
+    unsigned long bytes = 0;
+    int ch;
+    while ((ch = fgetc(file)) != EOF) {
+        ++bytes;
+        if (ch == 0) {
+            decodeFrame(frame, length, is_lead_in);
+            is_lead_in = false;
+            length = 0;
+        } else {
+            if (length < MAX_FRAME) frame[length] = (uint8_t) ch;
+            if (length <= MAX_FRAME) ++length;
+        }
+    }
+    fclose(file);
+    decodeFrame(frame, length, true); // a capture can also end mid-frame
+
+    unsigned long bad = counts.bad_cobs + counts.bad_length + counts.bad_crc + counts.unknown;
+    fprintf(stderr, "%lu bytes, %lu frames, %lu bad (cobs %lu, length %lu, crc %lu, unknown record %lu);",
+            bytes, counts.frames, bad, counts.bad_cobs, counts.bad_length, counts.bad_crc, counts.unknown);
+    for (unsigned type = 1; type < NUM_RECORDS; ++type) fprintf(stderr, " %s %lu", RECORDS[type].name, counts.records[type]);
+    fprintf(stderr, "\n");
+    return bad == 0 ? 0 : 1;
+}
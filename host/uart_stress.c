@@ -0,0 +1,174 @@
+// Hammers the EUSART4 ring buffers (serial.c) with a stand-in interrupt that
+// can land between any two instructions of the main loop: an interval timer
+// signals the process every few microseconds, and the signal handler plays
+// the RX and TX interrupts, pushing one received byte and pulling one byte
+// to transmit.
+// The main loop mixes blocking sends, try-sends and reads, and every byte is
+// checked for order against what was sent, allowing only for the drops the
+// counters report.
+//
+//   make -C host uart_stress && ./host/build/uart_stress [bytes]
+//
+// Exits non-zero if a byte is lost, duplicated or reordered, or the buffers stall.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+#include "hal_linux.h"
+#include "../serial.h"
+
+#define MAX_CHUNK 24 // longer than the TX buffer is free at times, shorter than the buffer
+#define INTERRUPT_US 10
+#define STALL_INTERRUPTS 200000 // ~2s of interrupts without a byte moving either way
+
+static long num_bytes;
+
+// byte number seq on the wire, never '\0' so strings can carry it
+static inline char wireByte(long seq) {
+    return (char) (seq % 255 + 1);
+}
+
+static struct {
+    volatile long produced; // bytes the interrupt tried to receive
+    volatile bool *lost; // [seq] the RX buffer was full
+    volatile long consumed; // next byte the main loop expects
+    long errors;
+} rx;
+
+static struct {
+    long queued; // bytes the main loop tried to send
+    volatile bool *refused; // [seq] try-send found no room
+    volatile long sent; // next byte the interrupt expects
+    volatile long errors;
+} tx;
+
+static volatile unsigned long interrupts;
+static unsigned long idle_interrupts;
+
+// one RX and one TX interrupt
+static void isr(int sig) {
+    (void) sig;
+    ++interrupts;
+    static long last_consumed, last_sent;
+    if (rx.consumed != last_consumed || tx.sent != last_sent) idle_interrupts = 0;
+    last_consumed = rx.consumed;
+    last_sent = tx.sent;
+    if (++idle_interrupts == STALL_INTERRUPTS) { // a lost or phantom byte has left a sender or reader waiting forever
+        static const char message[] = "FAIL stalled\n";
+        write(STDOUT_FILENO, message, sizeof(message) - 1);
+        _exit(1);
+    }
+    if (rx.produced < num_bytes) {
+        uint32_t dropped = EUSART4_getStats()->rx_dropped;
+        _EUSART4_putCharInRX(wireByte(rx.produced));
+        rx.lost[rx.produced] = EUSART4_getStats()->rx_dropped != dropped;
+        ++rx.produced;
+    }
+    bool is_empty;
+    char ch = _EUSART4_readCharFromTX(&is_empty);
+    if (!is_empty) {
+        while (tx.sent < num_bytes && tx.refused[tx.sent]) ++tx.sent;
+        if (tx.sent >= num_bytes || ch != wireByte(tx.sent)) ++tx.errors;
+        ++tx.sent;
+    }
+}
+
+static void readRX(void) {
+    bool is_empty;
+    char ch;
+    while (ch = EUSART4_readChar(&is_empty), !is_empty) {
+        while (rx.consumed < num_bytes && rx.lost[rx.consumed]) ++rx.consumed;
+        if (rx.consumed >= num_bytes || ch != wireByte(rx.consumed)) ++rx.errors;
+        ++rx.consumed;
+    }
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    num_bytes = argc > 1 ? atol(argv[1]) : 200000;
+    if (num_bytes < 1) {
+        fprintf(stderr, "usage: %s [bytes]\n", argv[0]);
+        return 2;
+    }
+    rx.lost = calloc((size_t) num_bytes, sizeof(bool));
+    tx.refused = calloc((size_t) num_bytes, sizeof(bool));
+    if (rx.lost == NULL || tx.refused == NULL) {
+        perror("calloc");
+        return 2;
+    }
+
+    hal_linux_reset();
+    hal_linux_holdUartTX(true); // TX only drains through isr()
+    EUSART4_init();
+
+    struct sigaction action = {0};
+    action.sa_handler = isr;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGALRM, &action, NULL);
+    struct itimerval timer = {.it_interval = {0, INTERRUPT_US}, .it_value = {0, INTERRUPT_US}};
+    setitimer(ITIMER_REAL, &timer, NULL);
+
+    double start = now_ns();
+    unsigned seed = 2;
+    char chunk[MAX_CHUNK + 1];
+    long try_sends = 0, try_refused = 0;
+    while (tx.queued < num_bytes) {
+        uint8_t length = (uint8_t) (1 + rand_r(&seed) % MAX_CHUNK);
+        if (length > num_bytes - tx.queued) length = (uint8_t) (num_bytes - tx.queued);
+        for (uint8_t i = 0; i < length; ++i) chunk[i] = wireByte(tx.queued + i);
+        chunk[length] = '\0';
+        switch (rand_r(&seed) % 3) {
+            case 0:
+                EUSART4_sendString(chunk);
+                break;
+            case 1:
+                ++try_sends;
+                if (!EUSART4_trySendString(chunk)) {
+                    ++try_refused;
+                    for (uint8_t i = 0; i < length; ++i) tx.refused[tx.queued + i] = true;
+                }
+                break;
+            default:
+                for (uint8_t i = 0; i < length; ++i) EUSART4_sendChar(chunk[i]);
+                break;
+        }
+        tx.queued += length;
+        readRX();
+    }
+    // let the interrupt drain TX and finish receiving
+    long last_queued = num_bytes; // refused bytes at the end never reach the interrupt
+    while (last_queued > 0 && tx.refused[last_queued - 1]) --last_queued;
+    while (tx.sent < last_queued || rx.produced < num_bytes) readRX();
+    readRX();
+    timer = (struct itimerval) {0};
+    setitimer(ITIMER_REAL, &timer, NULL);
+    double elapsed = now_ns() - start;
+    while (rx.consumed < num_bytes && rx.lost[rx.consumed]) ++rx.consumed;
+
+    const EUSART4Stats *stats = EUSART4_getStats();
+    long rx_lost = 0, tx_refused = 0;
+    for (long i = 0; i < num_bytes; ++i) {
+        rx_lost += rx.lost[i];
+        tx_refused += tx.refused[i];
+    }
+    bool ok = rx.errors == 0 && tx.errors == 0 && rx.consumed == num_bytes
+            && stats->rx_dropped == (uint32_t) rx_lost && stats->tx_dropped == (uint32_t) tx_refused;
+    printf("interrupts:     %lu over %.0f ms\n", interrupts, elapsed / 1e6);
+    printf("tx:             %ld bytes, %ld refused by %ld of %ld try-sends (counter %lu), %lu blocking sends waited, %ld errors\n",
+            num_bytes, tx_refused, try_refused, try_sends, (unsigned long) stats->tx_dropped, (unsigned long) stats->tx_waits, tx.errors);
+    printf("rx:             %ld bytes, %ld dropped with the buffer full (counter %lu), %ld errors\n",
+            num_bytes, rx_lost, (unsigned long) stats->rx_dropped, rx.errors + (num_bytes - rx.consumed));
+    printf("%s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -1,66 +1,184 @@
-#include <xc.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "i2c.h"
+#include "hal.h"
 
-#define _XTAL_FREQ 64000000 //note intrinsic _delay function is 62.5ns at 64,000,000Hz  
-#define _I2C_CLOCK 100000 //100kHz for I2C
+#define READ 0x01
 
-// initialise I2C module and pins
-void I2C2_init(void) {
-    //i2c config  
-    SSP2CON1bits.SSPM = 0b1000; // i2c master mode
-    SSP2CON1bits.SSPEN = 1; // enable i2c
-    SSP2ADD = (_XTAL_FREQ / (4 * _I2C_CLOCK)) - 1; // baud rate divider bits (in master mode)
-
-    // pin configuration for i2c  
-    TRISDbits.TRISD5 = 1; // disable output driver
-    TRISDbits.TRISD6 = 1; // disable output driver
-    ANSELDbits.ANSELD5 = 0; // digital mode
-    ANSELDbits.ANSELD6 = 0; // digital mode
-    SSP2DATPPS = 0x1D; // SDA on pin RD5
-    SSP2CLKPPS = 0x1E; // SCL on pin RD6
-    RD5PPS = 0x1C; // data output
-    RD6PPS = 0x1B; // clock output
+typedef enum {
+    STATE_IDLE,
+    STATE_START,
+    STATE_ADDRESS_WRITE,
+    STATE_WRITE, // command and write bytes
+    STATE_RESTART,
+    STATE_ADDRESS_READ,
+    STATE_RECEIVE,
+    STATE_ACK,
+    STATE_STOP,
+} State;
+
+static struct {
+    I2C2Transaction *head; // on the bus
+    I2C2Transaction *tail;
+    volatile State state;
+    uint8_t index; // next byte to write or read
+    I2C2Status result; // reported once the stop completes
+    volatile uint8_t timeout_ms;
+    I2C2Stats stats;
+} bus;
+
+// -------------------- START STATE MACHINE --------------------
+
+static void begin(void) {
+    bus.index = 0;
+    bus.result = I2C2_DONE;
+    bus.state = STATE_START;
+    bus.timeout_ms = I2C2_TIMEOUT_MS;
+    hal_i2c_start();
+}
+
+// retire the head and start the next queued transaction
+static void complete(I2C2Status status) {
+    I2C2Transaction *txn = bus.head;
+    bus.head = txn->next;
+    if (bus.head == NULL) bus.tail = NULL;
+    bus.state = STATE_IDLE;
+    bus.timeout_ms = 0;
+    ++bus.stats.transactions;
+    txn->status = status;
+    if (txn->callback != NULL) txn->callback(txn);
+    if (bus.head != NULL) begin();
+}
+
+// every byte on the bus goes through these two, for the stats
+static inline void sendByte(uint8_t byte) {
+    ++bus.stats.bytes;
+    hal_i2c_write(byte);
+}
+
+static inline void receiveByte(void) {
+    ++bus.stats.bytes;
+    hal_i2c_receive();
+}
+
+static void stop(I2C2Status result) {
+    bus.result = result;
+    bus.state = STATE_STOP;
+    hal_i2c_stop();
+}
+
+static void fail(void) {
+    ++bus.stats.nacks;
+    stop(I2C2_NACK);
 }
 
-// wait until I2C is idle
-void I2C2_waitForIdle(void) {
-    while ((SSP2STAT & 0x04) || (SSP2CON2 & 0x1F));
+void I2C2_interrupt(void) {
+    I2C2Transaction *txn = bus.head;
+    if (txn == NULL) return;
+    bus.timeout_ms = I2C2_TIMEOUT_MS;
+    switch (bus.state) {
+        case STATE_START:
+            bus.state = STATE_ADDRESS_WRITE;
+            sendByte(txn->address);
+            break;
+        case STATE_ADDRESS_WRITE:
+            if (!hal_i2c_acked()) {
+                fail();
+                break;
+            }
+            bus.state = STATE_WRITE;
+            sendByte(txn->command);
+            break;
+        case STATE_WRITE:
+            if (!hal_i2c_acked()) {
+                fail();
+            } else if (bus.index < txn->num_write) {
+                sendByte(txn->write[bus.index++]);
+            } else if (txn->num_read > 0) {
+                bus.index = 0;
+                bus.state = STATE_RESTART;
+                hal_i2c_repeatStart();
+            } else {
+                stop(I2C2_DONE);
+            }
+            break;
+        case STATE_RESTART:
+            bus.state = STATE_ADDRESS_READ;
+            sendByte(txn->address | READ);
+            break;
+        case STATE_ADDRESS_READ:
+            if (!hal_i2c_acked()) {
+                fail();
+                break;
+            }
+            bus.state = STATE_RECEIVE;
+            receiveByte();
+            break;
+        case STATE_RECEIVE:
+            txn->read[bus.index++] = hal_i2c_read();
+            bus.state = STATE_ACK;
+            hal_i2c_ack(bus.index < txn->num_read); // not acknowledging the last byte ends the read
+            break;
+        case STATE_ACK:
+            if (bus.index < txn->num_read) {
+                bus.state = STATE_RECEIVE;
+                receiveByte();
+            } else {
+                stop(I2C2_DONE);
+            }
+            break;
+        case STATE_STOP:
+            complete(bus.result);
+            break;
+        default:
+            break;
+    }
 }
 
-// send start bit
-void I2C2_start(void) {
-    I2C2_waitForIdle();
-    SSP2CON2bits.SEN = 1;
+void I2C2_tick(void) {
+    if (bus.timeout_ms == 0 || --bus.timeout_ms != 0) return;
+    // no interrupt for I2C2_TIMEOUT_MS: a slave is holding the bus
+    ++bus.stats.timeouts;
+    hal_i2c_recover();
+    complete(I2C2_TIMEOUT);
+}
+
+// -------------------- END STATE MACHINE --------------------
+
+void I2C2_init(void) {
+    bus.head = NULL;
+    bus.tail = NULL;
+    bus.state = STATE_IDLE;
+    bus.timeout_ms = 0;
+    hal_i2c_init();
 }
 
-// send repeated start bit
-void I2C2_repeatStart(void) {
-    I2C2_waitForIdle();
-    SSP2CON2bits.RSEN = 1;
+void I2C2_submit(I2C2Transaction *txn) {
+    txn->status = I2C2_PENDING;
+    txn->next = NULL;
+    bool enabled = hal_irq_disable(); // the interrupt also edits the queue
+    if (bus.tail == NULL) {
+        bus.head = txn;
+        bus.tail = txn;
+        begin();
+    } else {
+        bus.tail->next = txn;
+        bus.tail = txn;
+    }
+    hal_irq_restore(enabled);
 }
 
-// send stop bit
-void I2C2_stop() {
-    I2C2_waitForIdle();
-    SSP2CON2bits.PEN = 1;
+I2C2Status I2C2_transfer(I2C2Transaction *txn) {
+    I2C2_submit(txn);
+    while (txn->status == I2C2_PENDING) hal_waitForInterrupt();
+    return txn->status;
 }
 
-// send a byte
-void I2C2_sendByte(unsigned char data_byte) {
-    I2C2_waitForIdle();
-    SSP2BUF = data_byte;
+bool I2C2_isBusy(void) {
+    return bus.head != NULL;
 }
 
-// read a byte
-unsigned char I2C2_readByte(bool ack) {
-    unsigned char tmp;
-    I2C2_waitForIdle();
-    SSP2CON2bits.RCEN = 1; // put the module into receive mode
-    I2C2_waitForIdle();
-    tmp = SSP2BUF; // read data from SS2PBUF
-    I2C2_waitForIdle();
-    SSP2CON2bits.ACKDT = !ack; // acknowledge bit is active LOW
-    SSP2CON2bits.ACKEN = 1; // start acknowledge sequence
-    return tmp;
+const I2C2Stats *I2C2_getStats(void) {
+    return &bus.stats;
 }
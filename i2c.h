@@ -1,14 +1,50 @@
 #ifndef _i2c_H
 #define _i2c_H
 
+#include <stdint.h>
 #include <stdbool.h>
 
+// Interrupt-driven I2C2 master. Callers submit transactions to a queue and
+// carry on; the MSSP interrupt steps each one through start, address,
+// command, writes, repeated start, reads and stop. A transaction that makes no
+// progress for I2C2_TIMEOUT_MS is failed and the bus is recovered.
+
+#define I2C2_TIMEOUT_MS 3 // per bus event, at least 2 ticks of the 1kHz clock
+
+typedef enum {
+    I2C2_PENDING, // queued or on the bus
+    I2C2_DONE,
+    I2C2_NACK, // address or a written byte was not acknowledged
+    I2C2_TIMEOUT, // bus hung, recovered
+} I2C2Status;
+
+typedef struct I2C2Transaction {
+    uint8_t address; // 8-bit address with the R/W bit clear
+    uint8_t command; // first byte after the address, e.g. register address
+    const uint8_t *write; // written after the command
+    uint8_t num_write;
+    uint8_t *read; // read after a repeated start, nothing if num_read is 0
+    uint8_t num_read;
+    void (*callback)(struct I2C2Transaction *txn); // on completion, from the interrupt; may be NULL
+    volatile I2C2Status status;
+    struct I2C2Transaction *next; // queue link, owned by i2c.c
+} I2C2Transaction;
+
+typedef struct {
+    uint32_t transactions; // completed, whatever the outcome
+    uint32_t bytes; // clocked on the bus, including addresses and commands
+    uint16_t nacks;
+    uint16_t timeouts;
+} I2C2Stats;
+
 void I2C2_init(void);
-void I2C2_waitForIdle(void);
-void I2C2_start(void);
-void I2C2_repeatStart(void);
-void I2C2_stop(void);
-void I2C2_sendByte(unsigned char data_byte);
-unsigned char I2C2_readByte(bool ack);
+void I2C2_submit(I2C2Transaction *txn); // queue and return; txn must stay valid, and not be resubmitted, until it completes
+I2C2Status I2C2_transfer(I2C2Transaction *txn); // submit and wait for completion
+bool I2C2_isBusy(void);
+const I2C2Stats *I2C2_getStats(void); // cumulative, difference two snapshots to measure a call
+
+// called by the HAL
+void I2C2_interrupt(void); // MSSP finished the current bus event (SSP2IF)
+void I2C2_tick(void); // 1kHz, bus hang timeout
 
 #endif
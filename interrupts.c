@@ -5,8 +5,9 @@
 #include "serial.h"
 #include "colourClick.h"
 #include "motors.h"
-#include "timer.h"
 #include "flags.h"
+#include "hal.h"
+#include "i2c.h"
 
 #ifdef __BLINKERS
     volatile uint8_t blinkers_elapsed_ms = 0;
@@ -15,28 +16,51 @@
 void interrupts_init(void) {
     PIE4bits.RC4IE = 1; // enable EUSART4 RX interrupt
     PIE0bits.TMR0IE = 1;
+    PIE3bits.SSP2IE = 1; // I2C2 event complete; after a bus collision none comes and I2C2_tick() recovers
     #ifdef __CARD_LED
         PIE5bits.TMR2IE = 1; // enable TMR2 interrupt for LED PWM
     #endif
 
-    INTCONbits.IPEN = 0; // disable interrupt priority levels
-    INTCONbits.PEIE = 1; // enable peripheral interrupts
-    INTCONbits.GIE = 1; // enable global interrupts
+    // only the motor deadline is high priority, see hal_deadline_arm()
+    IPR0bits.TMR0IP = 0;
+    IPR3bits.SSP2IP = 0;
+    IPR4bits.RC4IP = 0;
+    IPR4bits.TX4IP = 0;
+    IPR5bits.TMR2IP = 0;
+    IPR5bits.TMR4IP = 1;
+
+    INTCONbits.IPEN = 1; // enable interrupt priority levels
+    INTCONbits.GIEL = 1; // enable low priority interrupts
+    INTCONbits.GIEH = 1; // enable all interrupts, hal_irq_disable() clears this
+}
+
+void __interrupt(high_priority) isr_high(void) {
+    if (PIR5bits.TMR4IF) { // one-shot motor deadline
+        PIR5bits.TMR4IF = 0;
+        motors_deadline();
+    }
 }
 
-void __interrupt() isr(void) {
+void __interrupt(low_priority) isr(void) {
     if (PIR0bits.TMR0IF) { // TMR0 flag for tracking time
         PIR0bits.TMR0IF = 0;
-        ++TMR0_elapsed_ms;
+        hal_clock_tick();
+        I2C2_tick();
+        motors_tick();
         #ifdef __BLINKERS
             if (++blinkers_elapsed_ms == BLINKER_PERIOD) {
-                if (is_flashing_brake) BRAKE_LED = ~BRAKE_LED;
-                if (is_flashing_left) LEFT_LED = ~LEFT_LED;
-                if (is_flashing_right) RIGHT_LED = ~RIGHT_LED;
+                if (is_flashing_brake) hal_gpio_toggle(BRAKE_LED);
+                if (is_flashing_left) hal_gpio_toggle(LEFT_LED);
+                if (is_flashing_right) hal_gpio_toggle(RIGHT_LED);
             }
         #endif
     }
     
+    if (PIR3bits.SSP2IF) { // I2C2 finished a bus event
+        PIR3bits.SSP2IF = 0;
+        I2C2_interrupt();
+    }
+    
     #ifdef __CARD_LED
         if (PIR5bits.TMR2IF) { // TMR2 flag for PWM
             PIR5bits.TMR2IF = 0; // reset flag
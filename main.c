@@ -18,52 +18,57 @@
 #include "interrupts.h"
 #include "flags.h"
 #include "buttons.h"
+#include "hal.h"
+#include "clock.h"
 
 #ifdef __DEBUG_MODE
-#include <stdio.h>
 #include "colourClick.h"
 #include "motors.h"
-#include "timer.h"
 #endif
 
 void main(void) {
     //    ADC_init();
+    interrupts_init(); // clock_sleep_ms() needs the TMR0 interrupt running
     EUSART4_init();
     buggy_init();
     buttons_init();
-    interrupts_init();
     
-    TRISDbits.TRISD7 = 0;
-    LATDbits.LATD7 = 0;
-    TRISHbits.TRISH3 = 0;
-    LATHbits.LATH3 = 0;
+    hal_gpio_setOutput(HAL_RD7_LED);
+    hal_gpio_write(HAL_RD7_LED, 0);
+    hal_gpio_setOutput(HAL_RH3_LED);
+    hal_gpio_write(HAL_RH3_LED, 0);
     
 //    while (PORTFbits.RF2) {}
-//    __delay_ms(1000);
+//    clock_sleep_ms(1000);
 //    colourClick_calibrateAll();   
 //    motors_calibrateAll();
 
-    char buf[30];
     while (1) {
-        while (PORTFbits.RF2) {}
-        __delay_ms(1000);
+        while (hal_gpio_read(HAL_RF2_BUTTON)) {}
+        clock_sleep_ms(1000);
         motors_advance();
 //        
-        while (PORTFbits.RF2) {}
-        __delay_ms(1000);
+        while (hal_gpio_read(HAL_RF2_BUTTON)) {}
+        clock_sleep_ms(1000);
         testReverse();
        
         
-        while (PORTFbits.RF2) {}
-        __delay_ms(1000);
+        while (hal_gpio_read(HAL_RF2_BUTTON)) {}
+        clock_sleep_ms(1000);
         testRightTurn();
         
-        while (PORTFbits.RF2) {}
-        __delay_ms(1000);
+        while (hal_gpio_read(HAL_RF2_BUTTON)) {}
+        clock_sleep_ms(1000);
         testLeftTurn();
+        bool enabled = hal_irq_disable(); // the deadline interrupt updates these, several bytes each
+        MotionStats motion = *motors_getStats(); // with and without __MOTOR_DEADLINE to compare
+        hal_irq_restore(enabled);
+        if (motion.switches != 0) {
+            log_info("switch late: max %uus, mean %uus\r\n", motion.late_max_us, (unsigned) (motion.late_total_us / motion.switches));
+        }
 //        
-//        while (PORTFbits.RF2) {}
-//        __delay_ms(1000);
+//        while (hal_gpio_read(HAL_RF2_BUTTON)) {}
+//        clock_sleep_ms(1000);
 //        motors_recentre();
 
 //        Card card = colourClick_readCard();
@@ -1,25 +1,23 @@
-#include <xc.h>
-#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "motors.h"
 #include "colourClick.h"
 #include "serial.h"
-#include "timer.h"
+#include "clock.h"
 #include "buttons.h"
+#include "hal.h"
+#include "calibration.h"
+#include "telemetry.h"
 
-#define _XTAL_FREQ 64000000 // for __delay_ms (shouldn't be used, use TMR0_delay_ms instead) 
-
-#define LAMP_LED LATHbits.LATH1
-#define BEAM_LED LATDbits.LATD3
+#define LAMP_LED HAL_LAMP_LED
+#define BEAM_LED HAL_BEAM_LED
 
 #define NUM_TESTS 5 // number of calibration tests
 
 #define PWM_PERIOD 100 // 10kHz with 1:16 pre-scaler
 #define STALL_POWER 50
-#define ACCEL_DURATION 100 // time in ms for deceleration
+#define ACCEL_DURATION 100 // default ramp time in ms, see ramp_up_ms
 
-#define PAUSE_DURATION 500 // time in ms for pauses between actions
 #define ALIGN_DURATION 500 // time in ms for full power alignment
 
 #ifdef __BLINKERS
@@ -41,99 +39,64 @@ uint16_t left_turn_duration = 350; // time in ms for completing 90deg left turn
 uint16_t right_turn_duration = 350; // time in ms for completing 90deg right turn
 uint16_t recenter_duration = 550; // time in ms for backing from wall to cell centre
 
+// Velocity profile: speed (power above STALL_POWER) ramps along RAMP[] over
+// these times. The S-curve's peak jerk is pi^2/2 * speed change / ramp^2, so
+// a longer ramp is a lower jerk limit. The durations above are cruise times,
+// see cruiseMs().
+uint8_t ramp_up_ms = ACCEL_DURATION;
+uint8_t ramp_down_ms = ACCEL_DURATION;
+
+// A stop ramps down and then holds the short brake for brake_duration, scaled
+// by the speed it stops from, then releases it and coasts for settle_duration
+// while the chassis stops rocking. These replace the 500ms coasting pause
+// between actions.
+uint8_t brake_duration = 80; // time in ms holding the brake after a stop from full speed
+uint8_t settle_duration = 100; // time in ms the stopped chassis takes to settle, brake off
+
 typedef struct {
     uint8_t power; // motor power, out of 100
     bool is_forward : 1; // motor direction, forward(1), reverse(0)
     bool is_brake : 1; // short or fast decay (brake or coast)
-    volatile unsigned char * const POS_DUTY; // PWM duty address for motor +ve side
-    volatile unsigned char * const NEG_DUTY; // PWM duty address for motor -ve side
+    const HalPwmChannel POS_DUTY; // PWM channel for motor +ve side
+    const HalPwmChannel NEG_DUTY; // PWM channel for motor -ve side
 } Motor;
 
 Motor motor_left = {
     .power = 0,
     .is_forward = true,
     .is_brake = false,
-    .POS_DUTY = &CCPR1H,
-    .NEG_DUTY = &CCPR2H,
+    .POS_DUTY = HAL_PWM_LEFT_POS,
+    .NEG_DUTY = HAL_PWM_LEFT_NEG,
 };
 
 Motor motor_right = {
     .power = 0,
     .is_forward = true,
     .is_brake = false,
-    .POS_DUTY = &CCPR3H,
-    .NEG_DUTY = &CCPR4H,
+    .POS_DUTY = HAL_PWM_RIGHT_POS,
+    .NEG_DUTY = HAL_PWM_RIGHT_NEG,
 };
 
 // function initialise T2 and CCP for DC motor control
 void motors_init(void) {
-    // TRIS and LAT pins for LEDs
-    BRAKE_LED = 0;
-    LEFT_LED = 0;
-    RIGHT_LED = 0;
-    LAMP_LED = 0;
-    BEAM_LED = 0;
-    TRISDbits.TRISD4 = 0;
-    TRISFbits.TRISF0 = 0;
-    TRISHbits.TRISH0 = 0;
-    TRISHbits.TRISH1 = 0;
-    TRISDbits.TRISD3 = 0;
+    // LED pins
+    hal_gpio_write(BRAKE_LED, 0);
+    hal_gpio_write(LEFT_LED, 0);
+    hal_gpio_write(RIGHT_LED, 0);
+    hal_gpio_write(LAMP_LED, 0);
+    hal_gpio_write(BEAM_LED, 0);
+    hal_gpio_setOutput(BRAKE_LED);
+    hal_gpio_setOutput(LEFT_LED);
+    hal_gpio_setOutput(RIGHT_LED);
+    hal_gpio_setOutput(LAMP_LED);
+    hal_gpio_setOutput(BEAM_LED);
     
-    
-    // TRIS and LAT registers for PWM  
-    TRISEbits.TRISE2 = 0; // output
-    TRISEbits.TRISE4 = 0; // output
-    TRISCbits.TRISC7 = 0; // output
-    TRISGbits.TRISG6 = 0; // output
-
-    // configure PPS to map CCP modules to pins
-    RE2PPS = 0x05; //CCP1 on RE2
-    RE4PPS = 0x06; //CCP2 on RE4
-    RC7PPS = 0x07; //CCP3 on RC7
-    RG6PPS = 0x08; //CCP4 on RG6
-
-    // TMR2 config
-    T2CONbits.CKPS = 0b100; // 1:16 prescaler
-    T2HLTbits.MODE = 0b00000; // free Running Mode, software gate only
-    T2CLKCONbits.CS = 0b0001; // Fosc/4
-    T2PR = PWM_PERIOD;
-    T2CONbits.ON = 1;
-
-    // setup CCP modules to output PMW signals
-    // initial duty cycles 
-    CCPR1H = 0;
-    CCPR2H = 0;
-    CCPR3H = 0;
-    CCPR4H = 0;
-
-    //use tmr2 for all CCP modules used
-    CCPTMRS0bits.C1TSEL = 0;
-    CCPTMRS0bits.C2TSEL = 0;
-    CCPTMRS0bits.C3TSEL = 0;
-    CCPTMRS0bits.C4TSEL = 0;
-
-    //configure each CCP
-    CCP1CONbits.FMT = 1; // left aligned duty cycle (we can just use high byte)
-    CCP1CONbits.CCP1MODE = 0b1100; // PWM mode  
-    CCP1CONbits.EN = 1; //turn on
-
-    CCP2CONbits.FMT = 1; // left aligned
-    CCP2CONbits.CCP2MODE = 0b1100; // PWM mode  
-    CCP2CONbits.EN = 1; //turn on
-
-    CCP3CONbits.FMT = 1; // left aligned
-    CCP3CONbits.CCP3MODE = 0b1100; // PWM mode  
-    CCP3CONbits.EN = 1; //turn on
-
-    CCP4CONbits.FMT = 1; // left aligned
-    CCP4CONbits.CCP4MODE = 0b1100; // PWM mode  
-    CCP4CONbits.EN = 1; //turn on
-    
-    TMR0_init(); // enable TMR0 for delays
+    hal_pwm_init(PWM_PERIOD); // CCP1-4 PWM on TMR2, initial duty cycles of 0
+    motors_stop();
 }
 
-// function to set CCP PWM output from the values in the motor structure
-void motors_setMotorPWM(Motor *m) {
+// CCP duty cycles for the values in the motor structure
+static void getDuties(const Motor *m, uint8_t *pos, uint8_t *neg) {
     uint8_t posDuty, negDuty; // duty cycle values for different sides of the motor
 
     if (m->is_brake) {
@@ -145,21 +108,29 @@ void motors_setMotorPWM(Motor *m) {
     }
 
     if (m->is_forward) {
-        *(m->POS_DUTY) = posDuty; // assign values to the CCP duty cycle registers
-        *(m->NEG_DUTY) = negDuty;
+        *pos = posDuty;
+        *neg = negDuty;
     } else {
-        *(m->POS_DUTY) = negDuty; // do it the other way around to change direction
-        *(m->NEG_DUTY) = posDuty;
+        *pos = negDuty; // do it the other way around to change direction
+        *neg = posDuty;
     }
 }
 
+// function to set CCP PWM output from the values in the motor structure
+void motors_setMotorPWM(Motor *m) {
+    uint8_t pos, neg;
+    getDuties(m, &pos, &neg);
+    hal_pwm_setDuty(m->POS_DUTY, pos); // assign values to the CCP duty cycles
+    hal_pwm_setDuty(m->NEG_DUTY, neg);
+}
+
 
 void motors_updatePWM(void) {
     motors_setMotorPWM(&motor_left);
     motors_setMotorPWM(&motor_right);
 }
 
-void motors_setPower(int8_t left, int8_t right) {
+static void setPowers(int8_t left, int8_t right) {
     motor_left.is_forward = left > 0;
     motor_right.is_forward = right > 0;
     motor_left.power = (uint8_t) (motor_left.is_forward ? left : -left);
@@ -167,171 +138,600 @@ void motors_setPower(int8_t left, int8_t right) {
     
     if (motor_left.power < STALL_POWER) motor_left.power = 0;
     if (motor_right.power < STALL_POWER) motor_right.power = 0;
-    motors_updatePWM();
-//    int8_t left_power_start = motor_left.is_forward ? (int8_t) motor_left.power : -(int8_t) motor_left.power;
-//    int8_t right_power_start = motor_right.is_forward ? (int8_t) motor_right.power : -(int8_t) motor_right.power;
-//    int8_t left_power_change = left - left_power_start;
-//    int8_t right_power_change = right - right_power_start;
-//    
-//    for (uint8_t i = 0; i <= ACCEL_DURATION; ++i) {
-//        int8_t left_power = (int8_t) (left_power_start + ((int16_t) left_power_change * i) / ACCEL_DURATION);
-//        motor_left.is_forward = left_power > 0;
-//        motor_left.power = (uint8_t) (motor_left.is_forward ? left_power : -left_power);
-//        
-//        int8_t right_power = (int8_t) (right_power_start + ((int16_t) right_power_change * i) / ACCEL_DURATION);
-//        motor_right.is_forward = right_power > 0;
-//        motor_right.power = (uint8_t) (motor_right.is_forward ? right_power : -right_power);
-//
-//        motors_updatePWM();
-//        TMR0_delay_ms(1);
-//    }
-//    
-//    if (motor_left.power < STALL_POWER) motor_left.power = 0;
-//    if (motor_right.power < STALL_POWER) motor_right.power = 0;
-//    motors_updatePWM();
-}
-
-inline void enableBrakeLights(void) {
-    #ifdef __BLINKERS
-        is_flashing_brake = true;
+}
+
+// Duties for motors_deadline() to write, double-buffered: the tick fills the
+// set the deadline isn't reading and then publishes it with one byte, so a
+// deadline that fires early or late writes a whole set, the newest one.
+typedef struct {
+    uint8_t left_pos;
+    uint8_t left_neg;
+    uint8_t right_pos;
+    uint8_t right_neg;
+} Duties;
+
+static Duties staged[2];
+static volatile uint8_t staged_ready; // index of the newest complete set
+static volatile bool is_staged; // it hasn't been written yet
+
+#ifndef __MOTOR_DEADLINE
+    static bool is_switched; // setMotors() wrote the PWM during this tick
+#endif
+
+// motor structs, and the PWM at the next tick from the deadline interrupt;
+// safe from the tick interrupt
+static void setMotors(int8_t left, int8_t right) {
+    setPowers(left, right);
+    #ifdef __MOTOR_DEADLINE
+        uint8_t next = staged_ready ^ 1;
+        getDuties(&motor_left, &staged[next].left_pos, &staged[next].left_neg);
+        getDuties(&motor_right, &staged[next].right_pos, &staged[next].right_neg);
+        staged_ready = next;
+        is_staged = true;
+        hal_deadline_arm();
+    #else
+        motors_updatePWM(); // straight away, as late into the tick as the interrupts before it ran
+        is_switched = true;
+    #endif
+}
+
+static inline int8_t signedPower(const Motor *m) {
+    return m->is_forward ? (int8_t) m->power : -(int8_t) m->power;
+}
+
+// what the main loop keeps track of when the power changes
+static void publishPower(int8_t left, int8_t right) {
+    clock_setMoving(left != 0 || right != 0);
+    #ifdef __TELEMETRY
+        telemetry_motors(left, right);
+    #endif
+}
+
+// -------------------- START MOTION --------------------
+
+// A primitive is a script of timed segments that motors_tick() steps through
+// from the 1kHz interrupt, so the main loop is free while the wheels turn.
+// Every script ends on a zero-length coast segment, so it leaves the motors in
+// fast decay with the lights off.
+
+#define MAX_ADVANCE_CELLS 8 // per script, longer advances run as several
+#define MAX_TURN_45 8 // per script, a full turn
+#define MAX_SEGMENTS (3 * MAX_ADVANCE_CELLS + 1) // cruise, brake and settle per cell, then coast; the most of any script
+
+#define LIGHT_BRAKE 0x01
+#define LIGHT_LEFT 0x02
+#define LIGHT_RIGHT 0x04
+
+typedef struct {
+    int8_t left; // power, as for motors_setPower()
+    int8_t right;
+    uint16_t ms; // 0 just sets the power and lights
+    uint8_t lights;
+    bool is_braking; // short-brake (slow) decay, otherwise coast (fast) decay
+} Segment;
+
+typedef struct {
+    int8_t from; // speed, signed power above STALL_POWER
+    int8_t to;
+} Ramp;
+
+static struct {
+    Segment segments[MAX_SEGMENTS];
+    uint8_t num_segments;
+    bool is_overflowed; // a segment didn't fit, the script is rejected
+    volatile uint8_t next; // segment the tick starts next
+    volatile uint16_t remaining_ms; // of the running segment
+    volatile bool is_busy;
+    volatile bool is_changed; // the target power changed since motors_poll()
+    int8_t target_left; // the running segment's power
+    int8_t target_right;
+    Ramp left;
+    Ramp right;
+    uint16_t ramp_phase; // 8.8 index into RAMP[]
+    uint16_t ramp_step; // per ms
+    uint8_t ramp_remaining_ms;
+    uint8_t lights;
+} motion;
+
+// -------------------- START PROFILE --------------------
+
+#define RAMP_STEPS 16
+
+// fraction of the speed change, 0..256, at the middle of each step
+static const uint8_t RAMP[RAMP_STEPS] = {
+    #ifdef __S_CURVE
+        1, 6, 15, 29, 47, 68, 91, 115, 141, 165, 188, 209, 227, 241, 250, 255, // (1 - cos(pi x)) / 2
     #else
-        BRAKE_LED = 1;
+        8, 24, 40, 56, 72, 88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248, // x, trapezoidal
     #endif
+};
+
+static inline int8_t speedOf(int8_t power) {
+    if (power > STALL_POWER) return power - STALL_POWER;
+    if (power < -STALL_POWER) return power + STALL_POWER;
+    return 0;
+}
+
+static inline int8_t powerOf(int8_t speed) {
+    if (speed > 0) return speed + STALL_POWER;
+    if (speed < 0) return speed - STALL_POWER;
+    return 0;
+}
+
+static inline int8_t rampSpeed(const Ramp *ramp, uint8_t fraction) {
+    return (int8_t) (ramp->from + (((int16_t) (ramp->to - ramp->from) * fraction + 128) >> 8)); // rounded
+}
+
+// the segment's power, reached over ramp_up_ms when speeding up or
+// ramp_down_ms when slowing down, whichever wheel needs more
+static void startRamp(const Segment *segment) {
+    motor_left.is_brake = segment->is_braking;
+    motor_right.is_brake = segment->is_braking;
+    motion.left = (Ramp) {speedOf(signedPower(&motor_left)), speedOf(segment->left)};
+    motion.right = (Ramp) {speedOf(signedPower(&motor_right)), speedOf(segment->right)};
+    bool is_speeding_up = motion.left.to * motion.left.to > motion.left.from * motion.left.from
+            || motion.right.to * motion.right.to > motion.right.from * motion.right.from;
+    uint8_t ramp_ms = is_speeding_up ? ramp_up_ms : ramp_down_ms;
+    if (segment->ms < ramp_ms) ramp_ms = (uint8_t) segment->ms;
+    if (ramp_ms == 0 || (motion.left.from == motion.left.to && motion.right.from == motion.right.to)) {
+        setMotors(segment->left, segment->right);
+        motion.ramp_remaining_ms = 0;
+        return;
+    }
+    motion.ramp_phase = 0;
+    motion.ramp_step = (uint16_t) ((RAMP_STEPS << 8) / ramp_ms); // the one division per segment
+    motion.ramp_remaining_ms = ramp_ms;
+    setMotors(powerOf(rampSpeed(&motion.left, RAMP[0])), powerOf(rampSpeed(&motion.right, RAMP[0])));
+}
+
+static void stepRamp(void) {
+    if (--motion.ramp_remaining_ms == 0) {
+        setMotors(motion.target_left, motion.target_right);
+        return;
+    }
+    motion.ramp_phase += motion.ramp_step;
+    uint8_t index = (uint8_t) (motion.ramp_phase >> 8);
+    uint8_t fraction = RAMP[index < RAMP_STEPS ? index : RAMP_STEPS - 1];
+    setMotors(powerOf(rampSpeed(&motion.left, fraction)), powerOf(rampSpeed(&motion.right, fraction)));
 }
 
-inline void disableBrakeLights(void) {
+// Distance short of full speed over a ramp of ramp_ms from rest, in 1/256 ms
+// at full speed: the fractions stepRamp() steps through, so it is exact for
+// the curve and the ramp time. A ramp down from full speed covers the same.
+static uint16_t rampShortfall(uint8_t ramp_ms) {
+    if (ramp_ms == 0) return 0;
+    uint16_t step = (uint16_t) ((RAMP_STEPS << 8) / ramp_ms); // as startRamp()
+    uint16_t phase = 0;
+    uint16_t shortfall = 0;
+    for (uint8_t i = 0; i < ramp_ms; ++i) {
+        uint8_t index = (uint8_t) (phase >> 8);
+        shortfall += 256 - RAMP[index < RAMP_STEPS ? index : RAMP_STEPS - 1];
+        phase += step;
+    }
+    return shortfall;
+}
+
+// Segment time covering the distance of cruise_ms at full speed, starting
+// and ending at rest. The ramp up falls short of full speed, which the
+// segment makes up; the ramp down runs into the stop's braking segment and
+// covers the distance that adds. With equal ramp times the two cancel.
+// Worked out once per change of ramp time, not in every script.
+static uint16_t cruiseMs(uint16_t cruise_ms) {
+    static uint8_t up_ms = 0, down_ms = 0; // shortfalls below are for these
+    static uint16_t up_shortfall = 0, down_shortfall = 0;
+    if (up_ms != ramp_up_ms) {
+        up_ms = ramp_up_ms;
+        up_shortfall = rampShortfall(up_ms);
+    }
+    if (down_ms != ramp_down_ms) {
+        down_ms = ramp_down_ms;
+        down_shortfall = rampShortfall(down_ms);
+    }
+    int16_t correction = (int16_t) (((int32_t) up_shortfall - down_shortfall) / 256);
+    return (uint16_t) ((int16_t) cruise_ms + correction);
+}
+
+// -------------------- END PROFILE --------------------
+
+// straight away, overriding a script's staged duties
+void motors_setPower(int8_t left, int8_t right) {
+    hal_deadline_cancel();
+    is_staged = false;
+    motor_left.is_brake = false;
+    motor_right.is_brake = false;
+    setPowers(left, right);
+    motors_updatePWM();
+    motion.target_left = signedPower(&motor_left);
+    motion.target_right = signedPower(&motor_right);
+    publishPower(motion.target_left, motion.target_right);
+}
+
+static void setLights(uint8_t lights) {
+    if (lights == motion.lights) return; // leave the blinkers in phase
+    motion.lights = lights;
     #ifdef __BLINKERS
-        is_flashing_brake = false;
+        is_flashing_brake = lights & LIGHT_BRAKE;
+        is_flashing_left = lights & LIGHT_LEFT;
+        is_flashing_right = lights & LIGHT_RIGHT;
+        if (!(lights & LIGHT_BRAKE)) hal_gpio_write(BRAKE_LED, 0);
+        if (!(lights & LIGHT_LEFT)) hal_gpio_write(LEFT_LED, 0);
+        if (!(lights & LIGHT_RIGHT)) hal_gpio_write(RIGHT_LED, 0);
+    #else
+        hal_gpio_write(BRAKE_LED, (lights & LIGHT_BRAKE) != 0);
+        hal_gpio_write(LEFT_LED, (lights & LIGHT_LEFT) != 0);
+        hal_gpio_write(RIGHT_LED, (lights & LIGHT_RIGHT) != 0);
     #endif
-    BRAKE_LED = 0;
 }
 
+static void addSegment(int8_t left, int8_t right, uint16_t ms, uint8_t lights) {
+    if (motion.num_segments == MAX_SEGMENTS) {
+        motion.is_overflowed = true;
+        return;
+    }
+    motion.segments[motion.num_segments++] = (Segment) {left, right, ms, lights, false};
+}
 
-void motors_advance(int8_t cells) {
+// stops from the previous segment with the brake on, for longer the faster it
+// went, then settles with it off
+static void addStop(uint8_t lights) {
+    if (motion.num_segments == MAX_SEGMENTS) {
+        motion.is_overflowed = true;
+        return;
+    }
+    uint8_t speed = 0;
+    if (motion.num_segments != 0) {
+        const Segment *previous = &motion.segments[motion.num_segments - 1];
+        int8_t left = speedOf(previous->left);
+        int8_t right = speedOf(previous->right);
+        if (left < 0) left = -left;
+        if (right < 0) right = -right;
+        speed = (uint8_t) (left > right ? left : right);
+    }
+    uint16_t brake_ms = (uint16_t) (((uint16_t) brake_duration * speed) / (100 - STALL_POWER));
+    motion.segments[motion.num_segments++] = (Segment) {0, 0, ramp_down_ms + brake_ms, lights, true};
+    addSegment(0, 0, settle_duration, lights);
+}
+
+// start segments until one takes time; false once the script is done
+static bool nextSegment(void) {
+    while (motion.next < motion.num_segments) {
+        const Segment *segment = &motion.segments[motion.next++];
+        if (segment->left != motion.target_left || segment->right != motion.target_right) motion.is_changed = true;
+        motion.target_left = segment->left;
+        motion.target_right = segment->right;
+        setLights(segment->lights);
+        if (segment->ms == 0) {
+            motor_left.is_brake = segment->is_braking;
+            motor_right.is_brake = segment->is_braking;
+            setMotors(segment->left, segment->right);
+        } else {
+            startRamp(segment);
+            motion.remaining_ms = segment->ms;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void beginScript(void) {
+    motion.num_segments = 0;
+    motion.is_overflowed = false;
+    motion.next = 0;
+}
+
+// the first segment starts here, the tick takes over once is_busy is set
+static void runScript(void) {
+    motion.is_busy = nextSegment();
+}
+
+static void scriptAdvance(int8_t cells) {
     if (cells == 0) return;
     bool is_reversing = cells < 0;
-    if (is_reversing) enableBrakeLights();
+    uint8_t lights = is_reversing ? LIGHT_BRAKE : 0;
     for (uint8_t i = 0; i < (is_reversing ? -cells : cells); ++i) {
-        if (is_reversing) {
-            motors_setPower(-left_slow_power, -right_slow_power);
-            __delay_ms(backward_duration);
-        } else {
-            motors_setPower(left_fast_power, right_fast_power);
-            __delay_ms(forward_fast_duration);
-        }
-        motors_setPower(0, 0);
-        __delay_ms(PAUSE_DURATION);
+        if (is_reversing) addSegment(-left_slow_power, -right_slow_power, cruiseMs(backward_duration), lights);
+        else addSegment(left_fast_power, right_fast_power, cruiseMs(forward_fast_duration), lights);
+        addStop(lights);
     }
-    disableBrakeLights();
+    addSegment(0, 0, 0, 0);
 }
 
-void motors_turn(int8_t num_45) {
+// one settling stop at the end, however many quarter turns
+static void scriptTurn(int8_t num_45) {
     if (num_45 == 0) return;
     int8_t num_90 = num_45 / 2;
     bool is_turning_right = num_45 > 0;
     int8_t power = is_turning_right ? turn_power : -turn_power;
-    
-    // blinkers
-    if (is_turning_right) {
-        #ifdef __BLINKERS
-            is_flashing_right = true;
-        #else
-            RIGHT_LED = 1;
-        #endif
-    } else {
-        #ifdef __BLINKERS
-            is_flashing_left = true;
-        #else
-            LEFT_LED = 1;
-        #endif
-    }
-    
-//    uint16_t duration = is_turning_right ? right_turn_duration : left_turn_duration;
+    uint8_t lights = is_turning_right ? LIGHT_RIGHT : LIGHT_LEFT;
+    uint16_t duration = is_turning_right ? right_turn_duration : left_turn_duration;
     for (uint8_t i = 0; i < (is_turning_right ? num_90 : -num_90); ++i) {
-        motors_setPower(power, -power);
-//        TMR0_delay_ms(duration);
-        if (is_turning_right)
-            __delay_ms(right_turn_duration);
-        else
-            __delay_ms(left_turn_duration);
-        motors_setPower(0, 0);
-        __delay_ms(PAUSE_DURATION);
+        if (i != 0) addStop(lights);
+        addSegment(power, -power, cruiseMs(duration), lights);
     }
     if (2 * num_90 != num_45) { // since turning durations are calibrated to 90deg, odd num_45 needs an additional half turn
-        motors_setPower(power, -power);
-//        TMR0_delay_ms(duration / 2);
-        if (is_turning_right)
-            __delay_ms(right_turn_duration/2);
-        else
-            __delay_ms(left_turn_duration/2);
-        motors_setPower(0, 0);
+        if (num_90 != 0) addStop(lights);
+        addSegment(power, -power, cruiseMs(duration / 2), lights);
     }
-    
-    #ifdef __BLINKERS
-        is_flashing_left = false;
-        is_flashing_right = false;
-    #endif
-    RIGHT_LED = 0;
-    LEFT_LED = 0;
-    __delay_ms(PAUSE_DURATION);
+    addStop(0);
+    addSegment(0, 0, 0, 0);
 }
 
-void motors_recentre(void) {
-    enableBrakeLights();
-    motors_setPower(-left_slow_power, -right_slow_power);
-    __delay_ms(recenter_duration);
-    motors_setPower(0, 0);
-    disableBrakeLights();
-    __delay_ms(PAUSE_DURATION);
+static void scriptRecentre(void) {
+    addSegment(-left_slow_power, -right_slow_power, cruiseMs(recenter_duration), LIGHT_BRAKE);
+    addStop(0);
+    addSegment(0, 0, 0, 0);
 }
 
-void motors_realign(bool is_forward) {
+static void scriptRealign(bool is_forward) {
     int8_t left_power = is_forward ? left_slow_power : -left_slow_power;
     int8_t right_power = is_forward ? right_slow_power : -right_slow_power;
     int8_t full_power = is_forward ? 100 : -100;
-    
-    if (!is_forward) enableBrakeLights();
+    uint8_t lights = is_forward ? 0 : LIGHT_BRAKE;
     
     // move forward to wall and align
-    motors_setPower(left_power, right_power);
-    __delay_ms(forward_duration / 2); // need 1/3 duration to wall, but use 1/2 to be safe
-    motors_setPower(full_power, full_power);
-    __delay_ms(ALIGN_DURATION);
-    motors_setPower(0, 0);
-    __delay_ms(PAUSE_DURATION);
-    
-    disableBrakeLights();
-    
+    addSegment(left_power, right_power, forward_duration / 2, lights); // need 1/3 duration to wall, but use 1/2 to be safe
+    addSegment(full_power, full_power, ALIGN_DURATION, lights);
+    addStop(lights);
     // return to centre
-    motors_setPower(-left_power, -right_power);
-    __delay_ms(recenter_duration);
+    addSegment(-left_power, -right_power, cruiseMs(recenter_duration), 0);
+    addStop(0);
+    addSegment(0, 0, 0, 0);
+}
+
+// -------------------- START QUEUE --------------------
+
+// Commands wait in a single-producer, single-consumer ring: motors_queue()
+// appends, and the tick starts the next one in the millisecond the previous
+// one finishes.
+
+#define QUEUE_MASK (MOTION_QUEUE_SIZE - 1)
+
+#if MOTION_QUEUE_SIZE & QUEUE_MASK
+#error "MOTION_QUEUE_SIZE must be a power of two"
+#endif
+
+static struct {
+    MotionCommand commands[MOTION_QUEUE_SIZE];
+    volatile uint8_t head; // next free slot, moved by motors_queue()
+    volatile uint8_t tail; // next command to run, moved by the tick
+    uint32_t idle_since_ms; // when the executor last ran dry
+    bool has_run; // idle_since_ms is set
+    bool is_split; // the command at tail is partly run, the rest of it is still there
+} queue;
+
+static MotionStats stats;
+
+static void finishCommand(void) {
+    ++stats.commands;
+    queue.idle_since_ms = hal_clock_ms();
+    queue.has_run = true;
+}
+
+// the largest arg one script holds, 0 if any arg fits
+static int8_t maxArg(uint8_t type) {
+    if (type == MOTION_ADVANCE) return MAX_ADVANCE_CELLS;
+    if (type == MOTION_TURN) return MAX_TURN_45;
+    return 0;
+}
+
+// returns whether a command started; with interrupts off or from the tick
+static bool startNext(void) {
+    while (queue.tail != queue.head) {
+        MotionCommand command = queue.commands[queue.tail];
+        bool is_continued = queue.is_split;
+        int8_t limit = maxArg(command.type);
+        queue.is_split = limit != 0 && (command.arg > limit || command.arg < -limit);
+        if (queue.is_split) { // run as much as fits and leave the rest in its slot
+            int8_t arg = command.arg > 0 ? limit : -limit;
+            queue.commands[queue.tail].arg -= arg;
+            command.arg = arg;
+        } else {
+            queue.tail = (queue.tail + 1) & QUEUE_MASK;
+        }
+        beginScript();
+        switch (command.type) {
+            case MOTION_ADVANCE: scriptAdvance(command.arg); break;
+            case MOTION_TURN: scriptTurn(command.arg); break;
+            case MOTION_RECENTRE: scriptRecentre(); break;
+            case MOTION_REALIGN: scriptRealign(command.arg != 0); break;
+        }
+        if (motion.is_overflowed) { // never run part of a script
+            ++stats.rejected;
+            beginScript();
+        }
+        uint32_t now = hal_clock_ms();
+        if (queue.has_run && !is_continued) {
+            if (now == queue.idle_since_ms) {
+                ++stats.handoffs;
+            } else {
+                ++stats.idle_gaps;
+                stats.idle_ms += now - queue.idle_since_ms;
+            }
+        }
+        runScript();
+        if (motion.is_busy) return true;
+        if (!queue.is_split) finishCommand(); // took no time, e.g. advance 0
+    }
+    return false;
+}
+
+bool motors_queue(MotionType type, int8_t arg) {
+    uint8_t next = (queue.head + 1) & QUEUE_MASK;
+    if (next == queue.tail) return false;
+    queue.commands[queue.head] = (MotionCommand) {type, arg};
+    bool enabled = hal_irq_disable(); // the tick also starts commands
+    queue.head = next;
+    uint8_t depth = motors_queueDepth();
+    if (depth > stats.max_depth) stats.max_depth = depth;
+    if (!motion.is_busy) startNext();
+    hal_irq_restore(enabled);
+    return true;
+}
+
+uint8_t motors_queueDepth(void) {
+    return (queue.head - queue.tail) & QUEUE_MASK;
+}
+
+uint16_t motors_finished(void) {
+    bool enabled = hal_irq_disable(); // 16 bits are two reads on the PIC18
+    uint16_t finished = stats.commands;
+    hal_irq_restore(enabled);
+    return finished;
+}
+
+const MotionStats *motors_getStats(void) {
+    return &stats;
+}
+
+// -------------------- END QUEUE --------------------
+
+void motors_stop(void) {
+    bool enabled = hal_irq_disable(); // the tick moves tail and starts commands
+    motion.is_busy = false;
+    queue.tail = queue.head;
+    queue.is_split = false;
+    beginScript();
+    motion.ramp_remaining_ms = 0;
+    hal_irq_restore(enabled);
     motors_setPower(0, 0);
-    __delay_ms(PAUSE_DURATION);
+    setLights(0);
+}
+
+#define TICK_US 1000
+#define EARLY_US 16 // a deadline this close before the tick fired early, see hal_deadline_arm()
+
+// how long after the tick the motors switched
+static void recordSwitch(uint16_t late_us) {
+    ++stats.switches;
+    stats.late_total_us += late_us;
+    if (late_us > stats.late_max_us) stats.late_max_us = late_us;
+}
+
+void motors_deadline(void) {
+    if (!is_staged) return; // already written by an earlier deadline
+    is_staged = false;
+    const Duties *duties = &staged[staged_ready];
+    hal_pwm_setDuty(motor_left.POS_DUTY, duties->left_pos);
+    hal_pwm_setDuty(motor_left.NEG_DUTY, duties->left_neg);
+    hal_pwm_setDuty(motor_right.POS_DUTY, duties->right_pos);
+    hal_pwm_setDuty(motor_right.NEG_DUTY, duties->right_neg);
+    uint16_t late_us = hal_clock_phaseUs();
+    if (late_us >= TICK_US - EARLY_US) late_us = 0; // just before the tick, not most of a tick late
+    recordSwitch(late_us);
 }
 
+void motors_tick(void) {
+    #ifndef __MOTOR_DEADLINE
+        is_switched = false; // a switch from the main loop isn't late for any tick
+    #endif
+    if (!motion.is_busy) return;
+    if (motion.ramp_remaining_ms != 0) stepRamp();
+    if (--motion.remaining_ms == 0) {
+        motion.is_busy = nextSegment();
+        if (!motion.is_busy) {
+            if (!queue.is_split) finishCommand(); // otherwise the rest of it follows
+            startNext();
+        }
+    }
+    #ifndef __MOTOR_DEADLINE
+        if (is_switched) recordSwitch(hal_clock_phaseUs());
+    #endif
+}
+
+bool motors_isBusy(void) {
+    return motion.is_busy;
+}
+
+bool motors_poll(void) {
+    bool is_busy = motion.is_busy; // read first, so the final power change is published before reporting done
+    if (motion.is_changed) {
+        motion.is_changed = false; // before reading the power, a change after this is published next time
+        publishPower(motion.target_left, motion.target_right);
+    }
+    return is_busy;
+}
+
+void motors_wait(void) {
+    clock_waitWhile(motors_poll);
+}
+
+static bool isQueueFull(void) {
+    return motors_poll() && motors_queueDepth() == QUEUE_MASK;
+}
+
+// waits for a free slot rather than drop the command
+static void queueWaiting(MotionType type, int8_t arg) {
+    while (!motors_queue(type, arg)) clock_waitWhile(isQueueFull);
+}
+
+void motors_startAdvance(int8_t cells) {
+    queueWaiting(MOTION_ADVANCE, cells);
+}
+
+void motors_startTurn(int8_t num_45) {
+    queueWaiting(MOTION_TURN, num_45);
+}
+
+void motors_startRecentre(void) {
+    queueWaiting(MOTION_RECENTRE, 0);
+}
+
+void motors_startRealign(bool is_forward) {
+    queueWaiting(MOTION_REALIGN, is_forward);
+}
+
+void motors_advance(int8_t cells) {
+    motors_startAdvance(cells);
+    motors_wait();
+}
+
+void motors_turn(int8_t num_45) {
+    motors_startTurn(num_45);
+    motors_wait();
+}
+
+void motors_recentre(void) {
+    motors_startRecentre();
+    motors_wait();
+}
+
+void motors_realign(bool is_forward) {
+    motors_startRealign(is_forward);
+    motors_wait();
+}
+
+// -------------------- END MOTION --------------------
+
 Card motors_search(uint8_t *cells_moved) {
     motors_setPower(left_fast_power, right_fast_power);
-    TMR0_startTimer();
+    uint32_t start_time = clock_now_ms();
     colourClick_waitUntilWall();
-    uint16_t elapsed_time = TMR0_endTimer();
-    *cells_moved = (uint8_t) ((float) elapsed_time / forward_duration);
+    uint16_t elapsed_time = (uint16_t) (clock_now_ms() - start_time);
+    *cells_moved = (uint8_t) (elapsed_time / forward_fast_duration);
     
-    __delay_ms(200);
+    colourClick_beginCard(); // long integration (and LED) while the buggy runs in
+    clock_sleep_ms(200);
     motors_setPower(0, 0);
-    __delay_ms(100);
+    clock_sleep_ms(100);
     motors_setPower(100, 100);
-    __delay_ms(ALIGN_DURATION);
+    uint16_t sample_ms = colourClick_sampleMs();
+    uint16_t frames_ms = COLOUR_CARD_FRAMES * sample_ms;
+    clock_sleep_ms(ALIGN_DURATION > frames_ms ? ALIGN_DURATION - frames_ms : 0);
+    for (uint8_t i = 0; i < COLOUR_CARD_FRAMES; ++i) { // integrate over the end of the push, squared up against the card
+        colourClick_startSample();
+        clock_sleep_ms(ALIGN_DURATION > frames_ms ? sample_ms : ALIGN_DURATION / COLOUR_CARD_FRAMES);
+    }
     motors_setPower(0, 0);
     
-    Card card = colourClick_readCard();
+    Card card = colourClick_endCard();
     
     #ifdef __STEPS_LED // flash number of steps estimated from time
-        __delay_ms(1000);
+        clock_sleep_ms(1000);
         for (uint8_t i = 0; i < *cells_moved; ++i) {
-            LATHbits.LATH3 = 1;
-            __delay_ms(200);
-            LATHbits.LATH3 = 0;
-            __delay_ms(200);
+            hal_gpio_write(HAL_RH3_LED, 1);
+            clock_sleep_ms(200);
+            hal_gpio_write(HAL_RH3_LED, 0);
+            clock_sleep_ms(200);
         }
     #endif
     
@@ -356,29 +756,29 @@ void testLeftTurn(void) {
     motors_turn(-8);
 }
 
-//void motors_calibrateAll(void) {
-//    static void (*const tests[NUM_TESTS])(void) = {motors_recentre, testForward, testReverse, testRightTurn, testLeftTurn};
-//    static const char *const test_names[NUM_TESTS] = {"recentre", "forward 1", "reverse 1", "right 8", "left 8"};
-//    static uint16_t *const durations[NUM_TESTS] = {&recenter_duration, &forward_duration, &backward_duration, &right_turn_duration, &left_turn_duration};
-//
-//    char buf[30];
-//    bool err;
-//    for (uint8_t i = 0; i < NUM_TESTS; ++i) {
-//        sprintf(buf, "> CALIBRATING %s <\r\n", test_names[i]); EUSART4_sendString(buf);
-//        TMR0_delay_ms(300);
-//        while (1) {
-//            sprintf(buf, "Current duration: %u\r\n", *(durations[i])); EUSART4_sendString(buf);
-//            EUSART4_sendString("Run: RF2; Done: RF3\r\n");
-//            if (buttons_readInput() == RF3_DOWN) break;
-//            (*tests[i])();
-//            EUSART4_sendString("New duration: ");
-//            int16_t value = EUSART4_read4DigitInt(&err);
-//            if (err) continue;
-//            if (value > 0) *(durations[i]) = (uint16_t) value;
-//        }
-//        sprintf(buf, "> FINISHED %s <\r\n", test_names[i]); EUSART4_sendString(buf);
-//    }
-//    EUSART4_sendString("> MOTORS CALIBRATED <");
-//}
+void motors_calibrateAll(void) {
+    static void (*const tests[NUM_TESTS])(void) = {motors_recentre, testForward, testReverse, testRightTurn, testLeftTurn};
+    static const char *const test_names[NUM_TESTS] = {"recentre", "forward 1", "reverse 1", "right 8", "left 8"};
+    static uint16_t *const durations[NUM_TESTS] = {&recenter_duration, &forward_fast_duration, &backward_duration, &right_turn_duration, &left_turn_duration};
+
+    bool err;
+    for (uint8_t i = 0; i < NUM_TESTS; ++i) {
+        EUSART4_print("> CALIBRATING %s <\r\n", test_names[i]);
+        clock_sleep_ms(300);
+        while (1) {
+            EUSART4_print("Current duration: %u\r\n", *(durations[i]));
+            EUSART4_sendString("Run: RF2; Done: RF3\r\n");
+            if (buttons_readInput() == RF3_DOWN) break;
+            (*tests[i])();
+            EUSART4_sendString("New duration: ");
+            int16_t value = EUSART4_read4DigitInt(&err);
+            if (err) continue;
+            if (value > 0) *(durations[i]) = (uint16_t) value;
+        }
+        EUSART4_print("> FINISHED %s <\r\n", test_names[i]);
+    }
+    calibration_save();
+    EUSART4_sendString("> MOTORS CALIBRATED <");
+}
 
 // -------------------- END CALIBRATION FUNCTIONS --------------------
\ No newline at end of file
@@ -1,15 +1,15 @@
 #ifndef _DC_MOTOR_H
 #define _DC_MOTOR_H
 
-#include <xc.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "colourClick.h"
+#include "hal.h"
 
 #define BLINKER_PERIOD 200 // ms
-#define BRAKE_LED LATDbits.LATD4
-#define LEFT_LED LATFbits.LATF0
-#define RIGHT_LED LATHbits.LATH0
+#define BRAKE_LED HAL_BRAKE_LED
+#define LEFT_LED HAL_LEFT_LED
+#define RIGHT_LED HAL_RIGHT_LED
 
 #ifdef __BLINKERS
     extern bool is_flashing_brake;
@@ -17,8 +17,53 @@
     extern bool is_flashing_right;
 #endif
 
+#define MOTION_QUEUE_SIZE 8 // power of two, holds one command less
+
+typedef enum {
+    MOTION_ADVANCE, // arg: cells, negative to reverse
+    MOTION_TURN, // arg: 45deg steps, positive to the right
+    MOTION_RECENTRE,
+    MOTION_REALIGN, // arg: is_forward
+} MotionType;
+
+typedef struct {
+    uint8_t type; // MotionType
+    int8_t arg;
+} MotionCommand;
+
+typedef struct {
+    uint16_t commands; // finished
+    uint16_t handoffs; // started in the millisecond the previous one finished
+    uint16_t idle_gaps; // started after the queue had run dry
+    uint32_t idle_ms; // total length of those gaps
+    uint8_t max_depth; // most commands waiting at once
+    uint16_t rejected; // scripts too long for the segment array, run as no motion
+    uint32_t switches; // PWM changes timed by the tick
+    uint32_t late_total_us; // after the tick, summed over those changes
+    uint16_t late_max_us;
+} MotionStats;
+
 void motors_init(void);
 void motors_setPower(int8_t left, int8_t right);
+
+// Queue primitives and poll them, or call the blocking versions, which wait
+// for everything queued before them too.
+bool motors_queue(MotionType type, int8_t arg); // false if the queue is full
+uint8_t motors_queueDepth(void); // commands waiting, not counting the one running
+uint16_t motors_finished(void); // commands finished so far, as in MotionStats
+const MotionStats *motors_getStats(void); // copy with interrupts off, the interrupts update it
+// the motors_start*() calls wait for a free slot when the queue is full
+void motors_startAdvance(int8_t cells);
+void motors_startTurn(int8_t num_45);
+void motors_startRecentre(void);
+void motors_startRealign(bool is_forward);
+bool motors_poll(void); // publishes power changes to the clock and telemetry, false once the queue is done
+bool motors_isBusy(void); // without publishing, e.g. from an interrupt
+void motors_wait(void); // until the queue is done
+void motors_stop(void); // abandons the running primitive and the queue
+void motors_tick(void); // from the 1kHz tick interrupt
+void motors_deadline(void); // from the high-priority deadline interrupt, see hal_deadline_arm()
+
 void motors_advance(int8_t cells);
 void motors_turn(int8_t num_45);
 void motors_recentre(void);
@@ -1,93 +1,74 @@
-#include <xc.h>
 #include <stdbool.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include "serial.h"
+#include "hal.h"
 
-#define RX_BUFFER_SIZE 20
-#define TX_BUFFER_SIZE 50
+#define RX_BUFFER_SIZE 32 // powers of two, at most 128
+#define TX_BUFFER_SIZE 64
+
+#if (RX_BUFFER_SIZE & (RX_BUFFER_SIZE - 1)) || RX_BUFFER_SIZE > 128 || (TX_BUFFER_SIZE & (TX_BUFFER_SIZE - 1)) || TX_BUFFER_SIZE > 128
+#error "ring buffer sizes must be powers of two up to 128"
+#endif
 
 #define PACKET_START '<'
 #define PACKET_END '>'
 
 // -------------------- RingBuffer --------------------
 
+// Single producer, single consumer: the producer only moves head and the
+// consumer only moves tail, each with a single byte store, so the ISR and
+// the main loop share a buffer without disabling interrupts. The indices
+// run freely and wrap at 256; head - tail is the number of bytes held.
 typedef struct {
-    unsigned char *data;
-    unsigned char start;
-    unsigned char end;
-    unsigned char num_data;
-    const unsigned char SIZE;
+    volatile unsigned char *const data;
+    volatile uint8_t head; // next byte written, producer only
+    volatile uint8_t tail; // next byte read, consumer only
+    const uint8_t MASK; // size - 1
 } RingBuffer;
 
-void ringBufferAppend(RingBuffer *buf, char ch) {
-    buf->data[buf->end] = ch;
-    if (++buf->end == buf->SIZE) buf->end = 0; // wrap around
-    
-    if (buf->num_data == buf->SIZE) { // buffer was full before this append
-        buf->start = buf->end; // move start pointer forward
-    } else {
-        ++buf->num_data; // update data count
-    }
+static inline uint8_t ringBufferFree(const RingBuffer *buf) {
+    return (uint8_t) (buf->MASK + 1 - (uint8_t) (buf->head - buf->tail));
 }
 
-char ringBufferRead(RingBuffer *buf, bool *is_empty) {
-    if (buf->num_data == 0) { // buffer is empty
+// false, leaving the buffer untouched, if it is full
+static inline bool ringBufferAppend(RingBuffer *buf, char ch) {
+    uint8_t head = buf->head;
+    if ((uint8_t) (head - buf->tail) > buf->MASK) return false;
+    buf->data[head & buf->MASK] = ch;
+    buf->head = head + 1; // publishes the byte
+    return true;
+}
+
+static inline char ringBufferRead(RingBuffer *buf, bool *is_empty) {
+    uint8_t tail = buf->tail;
+    if (buf->head == tail) { // buffer is empty
         *is_empty = true;
         return 0; 
     }
     
     *is_empty = false;
-    char ch = buf->data[buf->start];
-    if (++buf->start == buf->SIZE) buf->start = 0; // wrap around
-    --buf->num_data; // update data count
+    char ch = buf->data[tail & buf->MASK];
+    buf->tail = tail + 1; // frees the slot
     return ch;
 }
 
 // -------------------- Serial --------------------
 
-RingBuffer EUSART4_RX_buffer = {
-    .data = (unsigned char[RX_BUFFER_SIZE]) {0},
-    .start = 0,
-    .end = 0,
-    .num_data = 0,
-    .SIZE = RX_BUFFER_SIZE,
-};
-
-RingBuffer EUSART4_TX_buffer = {
-    .data = (unsigned char[TX_BUFFER_SIZE]) {0},
-    .start = 0,
-    .end = 0,
-    .num_data = 0,
-    .SIZE = TX_BUFFER_SIZE,
-};
+static volatile unsigned char rx_data[RX_BUFFER_SIZE];
+static volatile unsigned char tx_data[TX_BUFFER_SIZE];
+
+RingBuffer EUSART4_RX_buffer = {.data = rx_data, .head = 0, .tail = 0, .MASK = RX_BUFFER_SIZE - 1}; // ISR -> main loop
+RingBuffer EUSART4_TX_buffer = {.data = tx_data, .head = 0, .tail = 0, .MASK = TX_BUFFER_SIZE - 1}; // main loop -> ISR
+
+static EUSART4Stats stats;
 
 void EUSART4_init(void) {
-    // setup PPS mapping of EUSART TX/RX
-    RC0PPS = 0x12; // map EUSART4 TX to output at C0
-    RX4PPS = 0b00010001; // map EUSART RX to input at C1
-    //           | |+++------- PIN 1
-    //           +++---------- PORT C
-
-    // setup EUSART4
-    BAUD4CONbits.SCKP = 0; // idle TX state is high level (non-inverted)
-    BAUD4CONbits.BRG16 = 0; // 8-bit baud rate
-    BAUD4CONbits.WUE = 0; // disable wake-up enable bit
-    BAUD4CONbits.ABDEN = 0; // disable auto-baud detect
-    TX4STAbits.TX9 = 0; // 8-bit transmit
-    TX4STAbits.SYNC = 0; // asynchronous mode
-    TX4STAbits.SENDB = 0; // disable break bit
-    TX4STAbits.BRGH = 0; // low speed baud rate
-    RC4STAbits.RX9 = 0; // 8-bit reception
-    RC4STAbits.CREN = 1; // enable continuous reception
-    SP4BRGL = 103; // n = 103 => baudrate = 64e6/(64*(n+1)) = 9615bps
-    SP4BRGH = 0; // not used
-
-    TX4STAbits.TXEN = 1; // enable TX
-    RC4STAbits.SPEN = 1; // enable RX serial port
-}
-
-inline void EUSART4_flushTX(void) {
-    PIE4bits.TX4IE = 1; // enable TX interrupt to send content
+    hal_uart_init(); // HAL_UART_BAUD 8N1 on RC0/RC1
+}
+
+static inline void EUSART4_flushTX(void) {
+    hal_uart_kickTX(); // enable TX interrupt to send content
 }
 
 char EUSART4_readChar(bool *is_empty) {
@@ -102,7 +83,7 @@ const char *EUSART4_readLine() { // blocking call, waits for a line
         while (c = ringBufferRead(&EUSART4_RX_buffer, &is_empty), is_empty) {}
         if (c == '\n' || c == '\r') {
             EUSART4_sendString("\r\n"); // feedback
-            LATDbits.LATD7 = 1;
+            hal_gpio_write(HAL_RD7_LED, 1);
             str[i] = '\0';
             break;
         } else {
@@ -113,7 +94,7 @@ const char *EUSART4_readLine() { // blocking call, waits for a line
     return str;
 }
 
-const int16_t EUSART4_read4DigitInt(bool *err) { // waits for a number, range is -9999 to 9999
+int16_t EUSART4_read4DigitInt(bool *err) { // waits for a number, range is -9999 to 9999
     const char *line = EUSART4_readLine();
     int16_t num = 0;
     bool negative = false;
@@ -134,22 +115,155 @@ const int16_t EUSART4_read4DigitInt(bool *err) { // waits for a number, range is
     return negative ? -num : num;
 }
 
+// blocks while the buffer is full, so must not be called from an interrupt
 void EUSART4_sendChar(char ch) {
-    ringBufferAppend(&EUSART4_TX_buffer, ch);
+    if (!ringBufferAppend(&EUSART4_TX_buffer, ch)) {
+        ++stats.tx_waits;
+        do {
+            EUSART4_flushTX(); // make sure the ISR is draining
+            hal_waitForInterrupt();
+        } while (!ringBufferAppend(&EUSART4_TX_buffer, ch));
+    }
     EUSART4_flushTX();
 }
 
 void EUSART4_sendString(const char *string) {
     while (*string != '\0') {
-        ringBufferAppend(&EUSART4_TX_buffer, *string++);
+        if (!ringBufferAppend(&EUSART4_TX_buffer, *string)) {
+            EUSART4_sendChar(*string); // full: start sending what is queued and wait for room
+        }
+        ++string;
+    }
+    EUSART4_flushTX();
+}
+
+bool EUSART4_trySendChar(char ch) {
+    if (!ringBufferAppend(&EUSART4_TX_buffer, ch)) {
+        ++stats.tx_dropped;
+        return false;
+    }
+    EUSART4_flushTX();
+    return true;
+}
+
+// all or nothing: only the ISR touches the buffer meanwhile, and it only makes room
+bool EUSART4_trySendBytes(const void *bytes, uint8_t length) {
+    if (length > ringBufferFree(&EUSART4_TX_buffer)) {
+        stats.tx_dropped += length;
+        return false;
+    }
+    const char *next = bytes;
+    for (uint8_t i = 0; i < length; ++i) ringBufferAppend(&EUSART4_TX_buffer, next[i]);
+    EUSART4_flushTX();
+    return true;
+}
+
+bool EUSART4_trySendString(const char *string) {
+    uint8_t length = 0;
+    while (string[length] != '\0') {
+        if (++length > TX_BUFFER_SIZE) break; // can never fit
     }
+    return EUSART4_trySendBytes(string, length);
+}
+
+// -------------------- Formatting --------------------
+
+// straight into the TX buffer, waiting for room like EUSART4_sendString()
+static void queueChar(char ch) {
+    if (!ringBufferAppend(&EUSART4_TX_buffer, ch)) EUSART4_sendChar(ch);
+}
+
+// digits by repeated subtraction, the PIC18 has no divide instruction
+static void queueUnsigned(uint16_t value) {
+    static const uint16_t POWERS[4] = {10000, 1000, 100, 10};
+    bool is_leading = true;
+    for (uint8_t i = 0; i < 4; ++i) {
+        char digit = '0';
+        while (value >= POWERS[i]) {
+            value -= POWERS[i];
+            ++digit;
+        }
+        if (digit != '0' || !is_leading) {
+            queueChar(digit);
+            is_leading = false;
+        }
+    }
+    queueChar((char) ('0' + value));
+}
+
+static void queueHex(uint16_t value) {
+    bool is_leading = true;
+    for (int8_t shift = 12; shift >= 0; shift -= 4) {
+        uint8_t nibble = (value >> shift) & 0xf;
+        if (nibble == 0 && is_leading && shift != 0) continue;
+        queueChar((char) (nibble < 10 ? '0' + nibble : 'a' - 10 + nibble));
+        is_leading = false;
+    }
+}
+
+// Q2.14, truncated to two decimals
+static void queueQ14(uint16_t value) {
+    queueUnsigned(value >> 14);
+    queueChar('.');
+    uint32_t fraction = value & 0x3fff;
+    for (uint8_t i = 0; i < 2; ++i) {
+        fraction *= 10;
+        queueChar((char) ('0' + (fraction >> 14)));
+        fraction &= 0x3fff;
+    }
+}
+
+// a printf subset without a buffer: no widths, and %u/%d/%x take 16-bit ints
+void EUSART4_print(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    for (char ch; (ch = *format++) != '\0';) {
+        if (ch != '%') {
+            queueChar(ch);
+            continue;
+        }
+        switch (ch = *format++) {
+            case 'u':
+                queueUnsigned((uint16_t) va_arg(args, unsigned));
+                break;
+            case 'd': {
+                int16_t value = (int16_t) va_arg(args, int);
+                if (value < 0) queueChar('-');
+                queueUnsigned(value < 0 ? (uint16_t) -(uint16_t) value : (uint16_t) value);
+                break;
+            }
+            case 'x':
+                queueHex((uint16_t) va_arg(args, unsigned));
+                break;
+            case 'q':
+                queueQ14((uint16_t) va_arg(args, unsigned));
+                break;
+            case 'c':
+                queueChar((char) va_arg(args, int));
+                break;
+            case 's':
+                for (const char *string = va_arg(args, const char *); *string != '\0'; ++string) queueChar(*string);
+                break;
+            case '\0':
+                --format; // a lone % at the end
+                break;
+            default: // %% and anything unknown
+                queueChar(ch);
+                break;
+        }
+    }
+    va_end(args);
     EUSART4_flushTX();
 }
 
+const EUSART4Stats *EUSART4_getStats(void) {
+    return &stats;
+}
+
 // below are functions for interrupt operation
 
 void _EUSART4_putCharInRX(char ch) {
-    ringBufferAppend(&EUSART4_RX_buffer, ch);
+    if (!ringBufferAppend(&EUSART4_RX_buffer, ch)) ++stats.rx_dropped; // the oldest bytes belong to the reader, drop the newest
 }
 
 char _EUSART4_readCharFromTX(bool *is_empty) {
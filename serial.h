@@ -1,17 +1,55 @@
 #ifndef _SERIAL_H
 #define _SERIAL_H
 
-#include <xc.h>
-#include "stdbool.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "flags.h"
 
 #define PACKET_BUFFER_SIZE 5
 
+// log levels for __LOG_LEVEL in flags.h; messages above it compile to nothing
+#define LOG_OFF 0
+#define LOG_ERROR 1
+#define LOG_INFO 2
+#define LOG_DEBUG 3
+
+#ifndef __LOG_LEVEL
+#define __LOG_LEVEL LOG_ERROR
+#endif
+
+#if __LOG_LEVEL >= LOG_ERROR
+#define log_error(...) EUSART4_print(__VA_ARGS__)
+#else
+#define log_error(...) ((void) 0)
+#endif
+#if __LOG_LEVEL >= LOG_INFO
+#define log_info(...) EUSART4_print(__VA_ARGS__)
+#else
+#define log_info(...) ((void) 0)
+#endif
+#if __LOG_LEVEL >= LOG_DEBUG
+#define log_debug(...) EUSART4_print(__VA_ARGS__)
+#else
+#define log_debug(...) ((void) 0)
+#endif
+
+typedef struct {
+    uint32_t rx_dropped; // bytes received with the RX buffer full, counted by the ISR
+    uint32_t tx_dropped; // bytes refused by EUSART4_trySend*()
+    uint32_t tx_waits; // blocking sends that had to wait for room
+} EUSART4Stats;
+
 void EUSART4_init(void);
 char EUSART4_readChar(bool *is_empty);
 const char *EUSART4_readLine();
-const int16_t EUSART4_read4DigitInt(bool *err);
-void EUSART4_sendChar(char ch);
+int16_t EUSART4_read4DigitInt(bool *err);
+void EUSART4_sendChar(char ch); // waits for room in the TX buffer
 void EUSART4_sendString(const char *string);
+bool EUSART4_trySendChar(char ch); // false if the TX buffer is full
+bool EUSART4_trySendString(const char *string); // queues all of string or none of it
+bool EUSART4_trySendBytes(const void *bytes, uint8_t length); // binary, all or nothing
+void EUSART4_print(const char *format, ...); // %u %d %x %c %s %q (Q2.14 as x.xx) %%, waits for room
+const EUSART4Stats *EUSART4_getStats(void);
 uint8_t EUSART4_readPacket(char *buf);
 
 // below are for interrupt operation
@@ -0,0 +1,107 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "telemetry.h"
+#include "serial.h"
+#include "clock.h"
+#include "crc16.h"
+
+#ifdef __TELEMETRY
+
+#define MAX_FIELDS 9 // RGBC
+#define MAX_RECORD (1 + 4 + MAX_FIELDS + 2) // type, timestamp, fields, CRC
+#define MAX_FRAME (MAX_RECORD + 2) // COBS code byte, delimiter
+
+static struct {
+    uint8_t record[MAX_RECORD];
+    uint8_t length;
+} pending;
+
+static TelemetryStats stats;
+
+static void begin(TelemetryRecord type) {
+    uint32_t now = clock_now_ms();
+    pending.record[0] = type;
+    pending.record[1] = now & 0xff;
+    pending.record[2] = (now >> 8) & 0xff;
+    pending.record[3] = (now >> 16) & 0xff;
+    pending.record[4] = (now >> 24) & 0xff;
+    pending.length = 5;
+}
+
+static inline void put(uint8_t byte) {
+    pending.record[pending.length++] = byte;
+}
+
+static inline void put16(uint16_t word) {
+    put(word & 0xff);
+    put(word >> 8);
+}
+
+// CRC, then COBS: every 0x00 becomes the distance to the next one, so the
+// only 0x00 on the wire ends a frame and a receiver can resync on it
+static void send(void) {
+    put16(crc16(pending.record, pending.length));
+    uint8_t frame[MAX_FRAME];
+    uint8_t code_at = 0;
+    uint8_t length = 1;
+    for (uint8_t i = 0; i < pending.length; ++i) {
+        if (pending.record[i] == 0) {
+            frame[code_at] = length - code_at;
+            code_at = length++;
+        } else {
+            frame[length++] = pending.record[i];
+        }
+    }
+    frame[code_at] = length - code_at;
+    frame[length++] = 0;
+    if (EUSART4_trySendBytes(frame, length)) {
+        ++stats.records;
+        stats.bytes += length;
+    } else {
+        ++stats.dropped;
+    }
+}
+
+void telemetry_start(void) {
+    begin(TELEMETRY_START);
+    put(TELEMETRY_VERSION);
+    send();
+}
+
+void telemetry_rgbc(const uint16_t *crgb, bool is_led_on) {
+    begin(TELEMETRY_RGBC);
+    for (uint8_t i = 0; i < 4; ++i) put16(crgb[i]);
+    put(is_led_on);
+    send();
+}
+
+void telemetry_motors(int8_t left, int8_t right) {
+    begin(TELEMETRY_MOTORS);
+    put((uint8_t) left);
+    put((uint8_t) right);
+    send();
+}
+
+void telemetry_pose(int8_t x, int8_t y, uint8_t dir, uint8_t walls, uint8_t steps) {
+    begin(TELEMETRY_POSE);
+    put((uint8_t) x);
+    put((uint8_t) y);
+    put(dir);
+    put(walls);
+    put(steps);
+    send();
+}
+
+void telemetry_card(uint8_t card, uint8_t confidence, uint8_t num_samples) {
+    begin(TELEMETRY_CARD);
+    put(card);
+    put(confidence);
+    put(num_samples);
+    send();
+}
+
+const TelemetryStats *telemetry_getStats(void) {
+    return &stats;
+}
+
+#endif
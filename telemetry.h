@@ -0,0 +1,40 @@
+#ifndef TELEMETRY_H
+#define	TELEMETRY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "flags.h"
+
+// Binary telemetry on EUSART4, enabled by __TELEMETRY in flags.h. Each record
+// is a type byte, the clock_now_ms() timestamp (32-bit little-endian), the
+// fields below and a CRC16 (crc16.h) of all of that, COBS-encoded and ended
+// with a 0x00 byte. Records are dropped rather than waited for when the TX
+// buffer is full, so logging never holds up the mission.
+// host/telemetry_decode turns a capture into CSV or JSON.
+
+#define TELEMETRY_VERSION 1
+
+typedef enum {
+    TELEMETRY_START = 1, // version
+    TELEMETRY_RGBC, // c, r, g, b (16-bit), LED on
+    TELEMETRY_MOTORS, // left, right power (signed)
+    TELEMETRY_POSE, // x, y (signed), direction, walls, steps to start of the cell
+    TELEMETRY_CARD, // card, confidence, samples
+} TelemetryRecord;
+
+typedef struct {
+    uint32_t records; // queued
+    uint32_t bytes; // queued, framing included
+    uint32_t dropped; // TX buffer full
+} TelemetryStats;
+
+#ifdef __TELEMETRY
+void telemetry_start(void);
+void telemetry_rgbc(const uint16_t *crgb, bool is_led_on);
+void telemetry_motors(int8_t left, int8_t right);
+void telemetry_pose(int8_t x, int8_t y, uint8_t dir, uint8_t walls, uint8_t steps);
+void telemetry_card(uint8_t card, uint8_t confidence, uint8_t num_samples);
+const TelemetryStats *telemetry_getStats(void);
+#endif
+
+#endif	/* TELEMETRY_H */